@@ -0,0 +1,49 @@
+/**
+ * @file allocationcounter.hpp
+ * @brief Counts heap allocations of the benchmark executable.
+ *
+ * The benchmark executable replaces the global operator new, so every heap
+ * allocation made by the game logic, the standard library or the stack is
+ * counted. Benchmarks report the number per operation as "allocs/op".
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+/**
+ * @brief Get number of heap allocations made by the process so far.
+ * @return Number of calls to operator new.
+ */
+uint64_t allocationCount();
+
+/**
+ * @brief Counts allocations made between its construction and AllocationCounter::report().
+ * Construct it right before the benchmark loop so that setup is not counted.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter() : start(allocationCount()) {}
+
+    /**
+     * @brief Add the "allocs/op" counter to the benchmark.
+     * @param state State of the benchmark, after its loop has finished.
+     */
+    void report(benchmark::State &state) const
+    {
+        state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocationCount() - start), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    uint64_t start;
+};
+
+#endif // ALLOCATIONCOUNTER_HPP
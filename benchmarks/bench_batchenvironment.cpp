@@ -0,0 +1,85 @@
+#include "allocationcounter.hpp"
+#include "batchenvironment.hpp"
+#include "gamelogic.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+// Board sizes and batch sizes of the batch benchmarks.
+static const std::vector<int64_t> SIZES = {3, 5, 8, 16};
+static const std::vector<int64_t> BOARDS = {1024, 65536};
+
+// Actions cycling over all cells, different on every board.
+static std::vector<int> makeActions(int boards, int cells)
+{
+    std::vector<int> actions(boards);
+    for (int b = 0; b < boards; ++b)
+    {
+        actions[b] = (b * 7) % cells;
+    }
+    return actions;
+}
+
+// One step of a whole batch. Boards are never done, the difficulty is high and there is no move limit.
+static void BM_BatchStep(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int boards = static_cast<int>(state.range(1));
+    const int cells = size * size;
+    BatchEnvironment batch(boards, size, cells);
+    std::vector<uint64_t> seeds(boards);
+    for (int b = 0; b < boards; ++b)
+    {
+        seeds[b] = b;
+    }
+    batch.reset(seeds.data());
+    std::vector<int> actions = makeActions(boards, cells);
+    std::vector<float> rewards(boards);
+    std::vector<unsigned char> done(boards);
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        batch.step(actions.data(), rewards.data(), done.data());
+        for (int b = 0; b < boards; ++b)
+        {
+            actions[b] = actions[b] + 1 == cells ? 0 : actions[b] + 1;
+        }
+        benchmark::DoNotOptimize(batch.observations());
+    }
+    state.SetItemsProcessed(state.iterations() * boards);
+    state.SetLabel(BatchEnvironment::getKernelName());
+    allocations.report(state);
+}
+BENCHMARK(BM_BatchStep)->ArgsProduct({SIZES, BOARDS});
+
+// The same steps on one GameLogic per board, with makeMove() and isWin().
+static void BM_GameLogicStep(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int boards = static_cast<int>(state.range(1));
+    const int cells = size * size;
+    std::vector<std::unique_ptr<GameLogic>> games;
+    for (int b = 0; b < boards; ++b)
+    {
+        games.push_back(std::make_unique<GameLogic>(size));
+        games[b]->setDifficulty(cells);
+        games[b]->setSeed(b);
+        games[b]->init();
+    }
+    std::vector<int> actions = makeActions(boards, cells);
+    std::vector<unsigned char> done(boards);
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        for (int b = 0; b < boards; ++b)
+        {
+            games[b]->makeMove({actions[b] / size, actions[b] % size});
+            done[b] = games[b]->isWin();
+            actions[b] = actions[b] + 1 == cells ? 0 : actions[b] + 1;
+        }
+        benchmark::DoNotOptimize(done.data());
+    }
+    state.SetItemsProcessed(state.iterations() * boards);
+    allocations.report(state);
+}
+BENCHMARK(BM_GameLogicStep)->ArgsProduct({SIZES, BOARDS});
@@ -0,0 +1,85 @@
+#include "boardkernel.hpp"
+#include "gamelogic.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Move on a board of compile-time size, with fully unrolled loops.
+template <int N>
+static void BM_SpecializedIncrement(benchmark::State &state)
+{
+    std::vector<int> board(N * N, 9);
+    BoardKernel<N> kernel;
+    int cell = 0;
+    for (auto _ : state)
+    {
+        kernel.increment(board.data(), cell / N, cell % N);
+        benchmark::ClobberMemory();
+        cell = cell + 1 == N * N ? 0 : cell + 1;
+    }
+}
+BENCHMARK_TEMPLATE(BM_SpecializedIncrement, 3);
+BENCHMARK_TEMPLATE(BM_SpecializedIncrement, 4);
+BENCHMARK_TEMPLATE(BM_SpecializedIncrement, 5);
+BENCHMARK_TEMPLATE(BM_SpecializedIncrement, 8);
+
+// Same move through the generic runtime-sized kernel.
+static void BM_GenericIncrement(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::vector<int> board(size * size, 9);
+    BoardKernel<0> kernel(size);
+    int cell = 0;
+    for (auto _ : state)
+    {
+        kernel.increment(board.data(), cell / size, cell % size);
+        benchmark::ClobberMemory();
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+}
+BENCHMARK(BM_GenericIncrement)->Arg(3)->Arg(4)->Arg(5)->Arg(8);
+
+// Win check on a board where only the last cell is not 9, the worst case for both kernels.
+template <int N>
+static void BM_SpecializedIsSolved(benchmark::State &state)
+{
+    std::vector<int> board(N * N, 9);
+    board.back() = 1;
+    BoardKernel<N> kernel;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(kernel.isSolved(board.data()));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_SpecializedIsSolved, 3);
+BENCHMARK_TEMPLATE(BM_SpecializedIsSolved, 4);
+BENCHMARK_TEMPLATE(BM_SpecializedIsSolved, 5);
+BENCHMARK_TEMPLATE(BM_SpecializedIsSolved, 8);
+
+static void BM_GenericIsSolved(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::vector<int> board(size * size, 9);
+    board.back() = 1;
+    BoardKernel<0> kernel(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(kernel.isSolved(board.data()));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_GenericIsSolved)->Arg(3)->Arg(4)->Arg(5)->Arg(8);
+
+// Full GameLogic::makeMove through the size dispatch, including history bookkeeping.
+static void BM_MakeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    int cell = 0;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / size, cell % size});
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+}
+BENCHMARK(BM_MakeMove)->Arg(3)->Arg(4)->Arg(5)->Arg(8)->Arg(16)->Arg(128)->Arg(1024);
@@ -0,0 +1,28 @@
+#include "boardsymmetry.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+// Canonical forms of random boards per second, the cost of one cache or dedupe lookup.
+static void BM_Canonicalize(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<int> value(1, 9);
+    std::vector<std::vector<int>> boards(256, std::vector<int>(size * size));
+    for (auto &board : boards)
+    {
+        for (int &cell : board)
+        {
+            cell = value(gen);
+        }
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(BoardSymmetry::canonicalize(boards[i].data(), size).key);
+        i = (i + 1) % boards.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Canonicalize)->DenseRange(3, 8);
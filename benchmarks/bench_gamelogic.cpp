@@ -0,0 +1,133 @@
+#include "allocationcounter.hpp"
+#include "gamelogic.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Board sizes and history depths shared by the GameLogic benchmarks.
+static const std::vector<int64_t> SIZES = {3, 8, 64, 1024};
+static const std::vector<int64_t> DEPTHS = {0, 1024, 1 << 20};
+
+// Game of given size with a history of given depth, played on a diagonal so it is cheap to build.
+static void fillHistory(GameLogic &game, int depth)
+{
+    std::vector<GameLogic::Move> moves(depth);
+    for (int i = 0; i < depth; ++i)
+    {
+        moves[i] = {i % game.getSize(), (i / 3) % game.getSize()};
+    }
+    game.makeMoves(moves);
+}
+
+static void BM_GameMakeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    fillHistory(game, static_cast<int>(state.range(1)));
+    int cell = 0;
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / size, cell % size});
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameMakeMove)->ArgsProduct({SIZES, DEPTHS});
+
+// One undo followed by one redo at the top of a history of given depth.
+static void BM_GameUndoRedo(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    fillHistory(game, static_cast<int>(state.range(1)) + 1);
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        game.undoMove();
+        game.redoMove();
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameUndoRedo)->ArgsProduct({SIZES, DEPTHS});
+
+static void BM_GameIsWin(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.makeMove({size - 1, size - 1}); // Last cells differ, so every cell is checked.
+    game.makeMove({size - 1, size - 1});
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(game.isWin());
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameIsWin)->ArgsProduct({SIZES});
+
+// Move followed by stateHash(), the hash is updated along the row and column of every move.
+static void BM_GameMakeMoveHashed(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    benchmark::DoNotOptimize(game.stateHash());
+    int cell = 0;
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / size, cell % size});
+        benchmark::DoNotOptimize(game.stateHash());
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameMakeMoveHashed)->ArgsProduct({SIZES});
+
+static void BM_GameHintNextMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.setDifficulty(size * size);
+    game.init();
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(game.hintNextMove());
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameHintNextMove)->Arg(3)->Arg(4)->Arg(5)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_GameInit(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.setDifficulty(size * size);
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        game.init();
+    }
+    allocations.report(state);
+}
+BENCHMARK(BM_GameInit)->ArgsProduct({SIZES});
+
+// Score every cell after each move, as a heatmap overlay does.
+static void BM_GameScoreCells(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.setDifficulty(size);
+    game.init();
+    int cell = 0;
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / size, cell % size});
+        benchmark::DoNotOptimize(game.scoreCells());
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+    allocations.report(state);
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_GameScoreCells)->Arg(3)->Arg(8)->Arg(64)->Arg(512)->Unit(benchmark::kMicrosecond);
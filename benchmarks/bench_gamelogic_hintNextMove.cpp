@@ -0,0 +1,63 @@
+#include "gamelogic.hpp"
+#include "hintcache.hpp"
+#include "solver.hpp"
+#include <benchmark/benchmark.h>
+
+// Latency of a full hint request on a 3x3 board, must stay well below one microsecond.
+static void BM_HintNextMove(benchmark::State &state)
+{
+    GameLogic game;
+    game.setDifficulty(DEFAULT_SIZE * DEFAULT_SIZE);
+    game.init();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(game.hintNextMove());
+    }
+}
+BENCHMARK(BM_HintNextMove);
+
+static void BM_OptimalDistance(benchmark::State &state)
+{
+    GameLogic game;
+    game.setDifficulty(DEFAULT_SIZE * DEFAULT_SIZE);
+    game.init();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(game.getOptimalDistance());
+    }
+}
+BENCHMARK(BM_OptimalDistance);
+
+static void BM_SolverSolve(benchmark::State &state)
+{
+    int board[DEFAULT_SIZE * DEFAULT_SIZE] = {3, 7, 1, 9, 2, 5, 8, 4, 6};
+    int presses[DEFAULT_SIZE * DEFAULT_SIZE];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Solver::solve(board, DEFAULT_SIZE, presses));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_SolverSolve);
+
+// Hint after every move and undo, so each hint is on a changed board. With the cache both boards are
+// solved once and then looked up, arg 1 enables it.
+static void BM_HintAfterUndo(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.setDifficulty(size * size);
+    game.init();
+    if (state.range(1))
+    {
+        game.setHintCache(std::make_shared<HintCache>());
+    }
+    for (auto _ : state)
+    {
+        game.makeMove({0, 0});
+        benchmark::DoNotOptimize(game.hintNextMove());
+        game.undoMove();
+        benchmark::DoNotOptimize(game.hintNextMove());
+    }
+}
+BENCHMARK(BM_HintAfterUndo)->ArgsProduct({{3, 5, 8, 64, 256}, {0, 1}});
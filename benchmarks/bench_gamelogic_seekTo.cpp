@@ -0,0 +1,126 @@
+#include "gamelogic.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Jump between random positions of a 100k-move history.
+static void BM_SeekTo(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int moves = 100000;
+    GameLogic game(size);
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<> cell(0, size - 1);
+    for (int i = 0; i < moves; ++i)
+    {
+        game.makeMove({cell(gen), cell(gen)});
+    }
+    std::uniform_int_distribution<> position(0, moves);
+    for (auto _ : state)
+    {
+        game.seekTo(position(gen));
+        benchmark::DoNotOptimize(game.getBoardValue({0, 0}));
+    }
+}
+BENCHMARK(BM_SeekTo)->Arg(3)->Arg(8)->Arg(64)->Arg(256);
+
+// The same jumps with undo and redo, one move at a time.
+static void BM_UndoRedoWalk(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int moves = 100000;
+    GameLogic game(size);
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<> cell(0, size - 1);
+    for (int i = 0; i < moves; ++i)
+    {
+        game.makeMove({cell(gen), cell(gen)});
+    }
+    std::uniform_int_distribution<> position(0, moves);
+    for (auto _ : state)
+    {
+        int target = position(gen);
+        while (game.getNumMoves() > target)
+        {
+            game.undoMove();
+        }
+        while (game.getNumMoves() < target)
+        {
+            game.redoMove();
+        }
+        benchmark::DoNotOptimize(game.getBoardValue({0, 0}));
+    }
+}
+BENCHMARK(BM_UndoRedoWalk)->Arg(3)->Arg(64);
+
+// Play a batch of random moves and undo it, with one call each or one call per move.
+static void runBatch(benchmark::State &state, bool batched)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int count = static_cast<int>(state.range(1));
+    GameLogic game(size);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<> cell(0, size - 1);
+    std::vector<GameLogic::Move> moves(count);
+    for (auto &move : moves)
+    {
+        move = {cell(gen), cell(gen)};
+    }
+    for (auto _ : state)
+    {
+        if (batched)
+        {
+            game.makeMoves(moves);
+            game.undoMoves(count);
+        }
+        else
+        {
+            for (const auto &move : moves)
+            {
+                game.makeMove(move);
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                game.undoMove();
+            }
+        }
+        benchmark::DoNotOptimize(game.getBoardValue({0, 0}));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_MakeMovesBatch(benchmark::State &state)
+{
+    runBatch(state, true);
+}
+BENCHMARK(BM_MakeMovesBatch)->ArgsProduct({{3, 64}, {1, 16, 1024, 65536, 1 << 20}});
+
+static void BM_MakeMovesSingle(benchmark::State &state)
+{
+    runBatch(state, false);
+}
+BENCHMARK(BM_MakeMovesSingle)->ArgsProduct({{3, 64}, {1, 16, 1024, 65536, 1 << 20}});
+
+// Restore a saved game with a history of given length.
+static void BM_LoadSnapshot(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    const int count = static_cast<int>(state.range(1));
+    GameLogic game(size);
+    std::vector<GameLogic::Move> moves(count);
+    for (int i = 0; i < count; ++i)
+    {
+        moves[i] = {i % size, (i / size) % size};
+    }
+    game.makeMoves(moves);
+    std::string path = "bench_snapshot.t9s";
+    game.saveSnapshot(path);
+    GameLogic restored(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(restored.loadSnapshot(path));
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_LoadSnapshot)->ArgsProduct({{3, 64}, {1024, 1 << 20}})->Unit(benchmark::kMicrosecond);
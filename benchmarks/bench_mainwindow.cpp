@@ -0,0 +1,163 @@
+#include "boardwidget.hpp"
+#include "mainwindow.hpp"
+#include <QAction>
+#include <QApplication>
+#include <QMouseEvent>
+#include <QStandardPaths>
+#include <benchmark/benchmark.h>
+
+// Send a mouse event to the board like the mouse does.
+static void sendMouse(BoardWidget *board, QEvent::Type type, QPointF position, Qt::MouseButton button, Qt::MouseButtons buttons)
+{
+    QPointF global = board->mapToGlobal(position.toPoint());
+    QMouseEvent event(type, position, global, button, buttons, Qt::NoModifier);
+    QCoreApplication::sendEvent(board, &event);
+}
+
+// Click a cell of the board.
+static void clickCell(BoardWidget *board, GameLogic::Move move)
+{
+    QPointF center = board->cellRect(move).center();
+    sendMouse(board, QEvent::MouseButtonPress, center, Qt::LeftButton, Qt::LeftButton);
+    sendMouse(board, QEvent::MouseButtonRelease, center, Qt::LeftButton, Qt::NoButton);
+}
+
+// Check if a move would win the shown board, the win pop-up would wait for input.
+static bool winsBoard(const BoardWidget *board, int size, GameLogic::Move move)
+{
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            if (board->getShownValue({row, col}) != ((row == move.row || col == move.col) ? 8 : 9))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Click a cell and undo it, letting Qt repaint the window after each, as the player sees it.
+static void BM_ClickToPaint(benchmark::State &state)
+{
+    MainWindow window;
+    window.show();
+    QCoreApplication::processEvents();
+
+    BoardWidget *board = window.findChild<BoardWidget *>("board");
+    GameLogic::Move move = {0, 0};
+    while (move.col < 2 && winsBoard(board, 3, move))
+    {
+        ++move.col;
+    }
+    QAction *undo = window.findChild<QAction *>("actionUndo");
+    for (auto _ : state)
+    {
+        clickCell(board, move);
+        QCoreApplication::processEvents();
+        undo->trigger();
+        QCoreApplication::processEvents();
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_ClickToPaint)->Unit(benchmark::kMicrosecond);
+
+// A move on a large board repaints its row and column only.
+static void BM_BoardMoveToPaint(benchmark::State &state)
+{
+    int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.init();
+    BoardWidget board;
+    board.resize(800, 800);
+    board.setGame(&game);
+    board.show();
+    board.zoomTo(32, QPointF(400, 400)); // Values are drawn at this zoom.
+    QCoreApplication::processEvents();
+
+    GameLogic::Move move = {size / 2, size / 2};
+    for (auto _ : state)
+    {
+        game.makeMove(move);
+        board.refreshLines(move);
+        QCoreApplication::processEvents();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardMoveToPaint)->Arg(3)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Zoom in and out around the center of a large board, repainting the whole widget every step.
+static void BM_BoardZoom(benchmark::State &state)
+{
+    int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.init();
+    BoardWidget board;
+    board.resize(800, 800);
+    board.setGame(&game);
+    board.show();
+    QCoreApplication::processEvents();
+
+    double fit = board.cellRect({0, 0}).width();
+    double cell = fit;
+    double factor = 1.25;
+    for (auto _ : state)
+    {
+        cell *= factor;
+        if (cell > BoardWidget::MAX_CELL_SIZE || cell < fit)
+        {
+            factor = 1 / factor;
+            cell *= factor * factor;
+        }
+        board.zoomTo(cell, QPointF(400, 400));
+        QCoreApplication::processEvents();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardZoom)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Drag a zoomed in large board with the right button, repainting the whole widget every step.
+static void BM_BoardPan(benchmark::State &state)
+{
+    int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.init();
+    BoardWidget board;
+    board.resize(800, 800);
+    board.setGame(&game);
+    board.show();
+    board.zoomTo(32, QPointF(400, 400));
+    QCoreApplication::processEvents();
+
+    QPointF position(400, 400);
+    sendMouse(&board, QEvent::MouseButtonPress, position, Qt::RightButton, Qt::RightButton);
+    double step = 40;
+    int steps = 0;
+    for (auto _ : state)
+    {
+        if (++steps % 10 == 0)
+        {
+            step = -step; // Back and forth, so the board never reaches its edge.
+        }
+        position.rx() += step;
+        position.ry() += step / 2;
+        sendMouse(&board, QEvent::MouseMove, position, Qt::NoButton, Qt::RightButton);
+        QCoreApplication::processEvents();
+    }
+    sendMouse(&board, QEvent::MouseButtonRelease, position, Qt::RightButton, Qt::NoButton);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardPan)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char **argv)
+{
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen"); // No display needed.
+    }
+    QStandardPaths::setTestModeEnabled(true); // Sessions and snapshots go to a test directory.
+    QApplication app(argc, argv);
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
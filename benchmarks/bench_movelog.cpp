@@ -0,0 +1,80 @@
+#include "gamelogic.hpp"
+#include "movelog.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <random>
+#include <string>
+
+// Log of a session with a million random moves and some undo/redo runs.
+static std::string writeLog(int size)
+{
+    std::string path = "bench_movelog_" + std::to_string(size) + ".t9log";
+    std::vector<int> board(size * size, 9);
+    MoveLogWriter writer;
+    writer.open(path, size, 0, board.data());
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<> cell(0, size - 1);
+    for (int i = 0; i < (1 << 20); ++i)
+    {
+        writer.recordMove(cell(gen), cell(gen));
+        if (i % 1000 == 999)
+        {
+            writer.recordUndo();
+            writer.recordUndo();
+            writer.recordRedo();
+        }
+    }
+    writer.close();
+    return path;
+}
+
+static void BM_MoveLogWrite(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::string path = "bench_movelog_write.t9log";
+    std::vector<int> board(size * size, 9);
+    int64_t events = 0;
+    for (auto _ : state)
+    {
+        MoveLogWriter writer;
+        writer.open(path, size, 0, board.data());
+        for (int i = 0; i < (1 << 20); ++i)
+        {
+            writer.recordMove(i % size, (i >> 3) % size);
+        }
+        writer.close();
+        events += 1 << 20;
+    }
+    state.SetItemsProcessed(events);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_MoveLogWrite)->Arg(3)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_MoveLogReplay(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::string path = writeLog(size);
+    MoveLogReader reader(path);
+    GameLogic game(size);
+    for (auto _ : state)
+    {
+        reader.replay(game);
+    }
+    state.SetItemsProcessed(state.iterations() * reader.getEventCount());
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_MoveLogReplay)->Arg(3)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_MoveLogVerify(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::string path = writeLog(size);
+    MoveLogReader reader(path);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reader.verifySolution());
+    }
+    state.SetItemsProcessed(state.iterations() * reader.getEventCount());
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_MoveLogVerify)->Arg(3)->Arg(64)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,41 @@
+#include "gamelogic.hpp"
+#include <benchmark/benchmark.h>
+
+// Move followed by a win check, the work done on every click, in every storage.
+static void runMoves(benchmark::State &state, GameLogic::Storage storage)
+{
+    const int size = static_cast<int>(state.range(0));
+    GameLogic game(size);
+    game.setStorage(storage);
+    int cell = 0;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / size, cell % size});
+        benchmark::DoNotOptimize(game.isWin());
+        cell = cell + 1 == size * size ? 0 : cell + 1;
+    }
+}
+
+static void BM_DenseMove(benchmark::State &state)
+{
+    runMoves(state, GameLogic::Storage::Dense);
+}
+BENCHMARK(BM_DenseMove)->Arg(3)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_PackedMove(benchmark::State &state)
+{
+    runMoves(state, GameLogic::Storage::Packed);
+}
+BENCHMARK(BM_PackedMove)->Arg(3)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_TiledMove(benchmark::State &state)
+{
+    runMoves(state, GameLogic::Storage::Tiled);
+}
+BENCHMARK(BM_TiledMove)->Arg(3)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_LazyMove(benchmark::State &state)
+{
+    runMoves(state, GameLogic::Storage::Lazy);
+}
+BENCHMARK(BM_LazyMove)->Arg(3)->Arg(8)->Arg(64)->Arg(1024);
@@ -0,0 +1,89 @@
+#include "allocationcounter.hpp"
+#include "gamelogic.hpp"
+#include "stack.hpp"
+#include <benchmark/benchmark.h>
+
+// Linked-list stack that Stack<T> replaced: one heap node per push.
+template <typename T>
+class LinkedStack
+{
+public:
+    ~LinkedStack()
+    {
+        while (!isEmpty())
+        {
+            pop();
+        }
+    }
+    bool isEmpty() const
+    {
+        return topNode == nullptr;
+    }
+    void push(T value)
+    {
+        topNode = new Node{value, topNode};
+    }
+    T pop()
+    {
+        Node *temp = topNode;
+        T value = temp->data;
+        topNode = temp->next;
+        delete temp;
+        return value;
+    }
+
+private:
+    struct Node
+    {
+        T data;
+        Node *next;
+    };
+    Node *topNode = nullptr;
+};
+
+// Push a history of moves and pop it back, as in a long game with undo.
+template <typename S>
+static void runHistory(benchmark::State &state)
+{
+    const int depth = static_cast<int>(state.range(0));
+    S stack;
+    AllocationCounter allocations;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < depth; ++i)
+        {
+            stack.push({i, i});
+        }
+        while (!stack.isEmpty())
+        {
+            benchmark::DoNotOptimize(stack.pop());
+        }
+    }
+    allocations.report(state);
+    state.SetItemsProcessed(state.iterations() * depth);
+}
+
+static void BM_LinkedStack(benchmark::State &state)
+{
+    runHistory<LinkedStack<GameLogic::Move>>(state);
+}
+BENCHMARK(BM_LinkedStack)->Arg(16)->Arg(1024)->Arg(1 << 20);
+
+static void BM_ChunkedStack(benchmark::State &state)
+{
+    runHistory<Stack<GameLogic::Move>>(state);
+}
+BENCHMARK(BM_ChunkedStack)->Arg(16)->Arg(1024)->Arg(1 << 20);
+
+// Moves with a win check on a 3x3 board, every move pushes to the history.
+static void BM_MakeMoveHistory(benchmark::State &state)
+{
+    GameLogic game;
+    int cell = 0;
+    for (auto _ : state)
+    {
+        game.makeMove({cell / 3, cell % 3});
+        cell = cell == 8 ? 0 : cell + 1;
+    }
+}
+BENCHMARK(BM_MakeMoveHistory);
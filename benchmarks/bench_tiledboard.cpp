@@ -0,0 +1,91 @@
+#include "boardkernel.hpp"
+#include "lazyboard.hpp"
+#include "packedboard.hpp"
+#include "tiledboard.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+// Board sizes from one that fits in L1 to 4096x4096, far larger than the caches.
+static const std::vector<int64_t> SIZES = {64, 256, 1024, 2048, 4096};
+
+// Random moves, so consecutive moves do not reuse cached lines.
+static std::vector<int> randomLines(int size)
+{
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<int> line(0, size - 1);
+    std::vector<int> lines(1 << 12);
+    for (int &value : lines)
+    {
+        value = line(gen);
+    }
+    return lines;
+}
+
+// Moves on a row-major board of one int per cell, every cell of a column is in another cache line.
+static void BM_DenseLargeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    std::vector<int> board(static_cast<std::size_t>(size) * size, 9);
+    BoardKernel<0> kernel(size);
+    std::vector<int> lines = randomLines(size);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(kernel.increment(board.data(), lines[i], lines[i + 1]));
+        i = (i + 2) & (lines.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * (2 * size - 1)); // Cells changed per move.
+}
+BENCHMARK(BM_DenseLargeMove)->ArgsProduct({SIZES});
+
+static void BM_PackedLargeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    PackedBoard board;
+    board.reset(size);
+    std::vector<int> lines = randomLines(size);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(board.increment(lines[i], lines[i + 1]));
+        i = (i + 2) & (lines.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * (2 * size - 1));
+}
+BENCHMARK(BM_PackedLargeMove)->ArgsProduct({SIZES});
+
+// Moves on a tiled board, rows and columns touch size / 8 cache lines each.
+static void BM_TiledLargeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    TiledBoard board;
+    board.reset(size);
+    std::vector<int> lines = randomLines(size);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(board.increment(lines[i], lines[i + 1]));
+        i = (i + 2) & (lines.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * (2 * size - 1));
+}
+BENCHMARK(BM_TiledLargeMove)->ArgsProduct({SIZES});
+
+// Moves on a lazy board only change two press counts and one cell, the cost does not grow with the size.
+static void BM_LazyLargeMove(benchmark::State &state)
+{
+    const int size = static_cast<int>(state.range(0));
+    LazyBoard board;
+    board.reset(size);
+    std::vector<int> lines = randomLines(size);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        board.increment(lines[i], lines[i + 1]);
+        benchmark::ClobberMemory();
+        i = (i + 2) & (lines.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * (2 * size - 1));
+}
+BENCHMARK(BM_LazyLargeMove)->ArgsProduct({SIZES});
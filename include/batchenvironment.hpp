@@ -0,0 +1,153 @@
+/**
+ * @file batchenvironment.hpp
+ * @brief Header file for the BatchEnvironment class.
+ *
+ * This file contains the declaration of the BatchEnvironment class, which
+ * plays many boards of the same size at once for reinforcement learning.
+ * The boards are stored as arrays of fields instead of one GameLogic per
+ * board: all cell values in one contiguous byte buffer, board after board,
+ * and the move counts, unsolved cell counts and done flags in arrays of
+ * their own. There is no history, so a step costs no allocation.
+ *
+ * Boards up to VECTOR_MAX_SIZE are stepped by adding a precomputed mask of
+ * the move's row and column to the whole board with AVX2 or SSE2, whichever
+ * the compiler targets, larger boards and builds without SSE2 update the
+ * row and column cell by cell. Every step gives the same board as
+ * GameLogic::makeMove() and the same win as GameLogic::isWin().
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gamelogic.hpp"
+#include "gamerandom.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef BATCHENVIRONMENT_HPP
+#define BATCHENVIRONMENT_HPP
+
+/**
+ * @brief Steps a batch of boards with one move per board and call.
+ */
+class BatchEnvironment
+{
+public:
+    static constexpr int VECTOR_MAX_SIZE = 16; // Largest board stepped with vector instructions.
+    static constexpr float WIN_REWARD = 1.0f;  // Reward of the step that wins a board, other steps get 0.
+
+    /**
+     * @brief Constructs a batch. The boards are all 9 until reset.
+     * @param boards Number of boards, at least one.
+     * @param size Size of every board.
+     * @param difficulty Difficulty of the boards made by reset(), see GameLogic::setDifficulty().
+     * @param maxMoves Moves after which a board that is not won is done, 0 for no limit.
+     * @throw std::out_of_range if a parameter is out of its range.
+     */
+    explicit BatchEnvironment(int boards, int size = DEFAULT_SIZE, int difficulty = 1, int maxMoves = 0);
+
+    /**
+     * @brief Set the random stream of the boards made by reset(), see GameLogic::setRandomStream().
+     * @param stream Index of the stream.
+     * @param engine Engine of the stream.
+     */
+    void setRandomStream(uint64_t stream, GameRandom::Engine engine = GameRandom::Engine::Philox);
+
+    /**
+     * @brief Start a new game on every board. Board i gets the board GameLogic::init() makes for seeds[i].
+     * @param seeds One seed per board.
+     */
+    void reset(const uint64_t *seeds);
+
+    /**
+     * @brief Start a new game on one board, e.g. after it is done.
+     * @param board Index of the board.
+     * @param seed Seed of the new board.
+     * @throw std::out_of_range if there is no such board.
+     */
+    void reset(int board, uint64_t seed);
+
+    /**
+     * @brief Make one move on every board. Boards that are done and boards with a negative action are left as they are.
+     * @param actions One move per board, the cell row * size + col or -1.
+     * @param rewards Output of one reward per board: WIN_REWARD if the move won the board, otherwise 0.
+     * @param done Output of one flag per board: 1 if the board is won or has reached maxMoves.
+     * @throw std::out_of_range if an action is outside the board. No board is changed then.
+     */
+    void step(const int *actions, float *rewards, unsigned char *done);
+
+    /**
+     * @brief Get the cell values of all boards, size * size row-major bytes per board, board after board.
+     * @return Pointer to getBoardCount() * size * size values, valid until the batch is destroyed.
+     */
+    const unsigned char *observations() const;
+
+    /**
+     * @brief Get number of moves made on a board since its reset.
+     * @param board Index of the board.
+     * @return Number of moves.
+     */
+    int getNumMoves(int board) const;
+
+    /**
+     * @brief Check if all values of a board are 9.
+     * @param board Index of the board.
+     * @return True if the board is won.
+     */
+    bool isWin(int board) const;
+
+    /**
+     * @brief Get number of boards.
+     * @return Number of boards.
+     */
+    int getBoardCount() const;
+
+    /**
+     * @brief Get size of the boards.
+     * @return Number of rows and columns of every board.
+     */
+    int getSize() const;
+
+    /**
+     * @brief Get name of the instructions used by step() for boards up to VECTOR_MAX_SIZE.
+     * @return "avx2", "sse2" or "scalar".
+     */
+    static const char *getKernelName();
+
+private:
+    /**
+     * @brief Add the mask of a move to a board with vector instructions.
+     * @param board Index of the board.
+     * @param action Cell of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int stepMasked(int board, int action);
+
+    /**
+     * @brief Increment the row and column of a move cell by cell.
+     * @param board Index of the board.
+     * @param action Cell of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int stepLines(int board, int action);
+
+    int boards;
+    int size;
+    int cells;
+    int difficulty;
+    int maxMoves;
+    uint64_t randomStream;
+    GameRandom::Engine randomEngine;
+    std::vector<unsigned char> values;   // Cell values, board after board, followed by padding for the last vector.
+    std::vector<int> unsolved;           // Cells not equal to 9 per board.
+    std::vector<int> moves;              // Moves per board.
+    std::vector<unsigned char> finished; // Done flag per board.
+    std::vector<unsigned char> masks;    // Per move: 1 in its row and column, 0 elsewhere, maskStride bytes each.
+    std::size_t maskStride;              // Bytes per mask, cells rounded up to whole vectors.
+    std::vector<int> generated;          // Board made by GameLogic::generateBoard().
+};
+
+#endif // BATCHENVIRONMENT_HPP
@@ -0,0 +1,81 @@
+/**
+ * @file boardhash.hpp
+ * @brief Zobrist hash of a board.
+ *
+ * The hash of a board is the XOR of one 64-bit key per cell and value. A
+ * move changes the values of its row and column only, so GameLogic updates
+ * the hash by XORing out the old key and in the new key of those cells.
+ * Keys are computed from the board size, cell and value instead of being
+ * kept in a table, which would need 72 bytes per cell on large boards. The
+ * hash only depends on the size and values, equal boards hash equal in
+ * every game, storage and process.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <cstdint>
+
+#ifndef BOARDHASH_HPP
+#define BOARDHASH_HPP
+
+/**
+ * @brief Get the key of a cell, independent of its value.
+ * @param size Number of rows and columns of the board.
+ * @param cell Row-major index of the cell.
+ * @return The splitmix64 finalizer of size and cell.
+ */
+inline uint64_t boardHashCellKey(int size, int cell)
+{
+    uint64_t z = (static_cast<uint64_t>(size) << 32 | static_cast<uint32_t>(cell)) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Get the key of a value in a cell: the cell key times an odd constant of the value, one mix per cell.
+ * @param cellKey Key of the cell from boardHashCellKey().
+ * @param value Value in range [1, 9].
+ * @return Key.
+ */
+inline uint64_t boardHashKey(uint64_t cellKey, int value)
+{
+    static constexpr uint64_t VALUE_KEYS[10] = {0, 0xD6E8FEB86659FD93ull, 0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull,
+                                                0x8EBC6AF09C88C6E3ull, 0x589965CC75374CC3ull, 0x1D8E4E27C47D124Full,
+                                                0xFF51AFD7ED558CCDull, 0xC4CEB9FE1A85EC53ull, 0x9FB21C651E98DF25ull};
+    uint64_t key = cellKey * VALUE_KEYS[value];
+    return key ^ (key >> 29); // Low bits of a product only depend on low bits of the factors.
+}
+
+/**
+ * @brief Get the change of the hash when a move changes one cell.
+ * @param cellKey Key of the cell from boardHashCellKey().
+ * @param value Value of the cell before the move.
+ * @param reverse True if the move is undone, i.e. the value is decremented instead of incremented.
+ * @return Keys of the old and the new value XORed.
+ */
+inline uint64_t boardHashStep(uint64_t cellKey, int value, bool reverse)
+{
+    int next = reverse ? (value == 1 ? 9 : value - 1) : (value == 9 ? 1 : value + 1);
+    return boardHashKey(cellKey, value) ^ boardHashKey(cellKey, next);
+}
+
+/**
+ * @brief Hash a whole board.
+ * @param values Row-major array of size*size values in range [1, 9].
+ * @param size Number of rows and columns.
+ * @return Hash of the board, the same as GameLogic::stateHash() of a game showing it.
+ */
+inline uint64_t hashBoard(const int *values, int size)
+{
+    uint64_t hash = 0;
+    for (int cell = 0; cell < size * size; ++cell)
+    {
+        hash ^= boardHashKey(boardHashCellKey(size, cell), values[cell]);
+    }
+    return hash;
+}
+
+#endif // BOARDHASH_HPP
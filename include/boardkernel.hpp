@@ -0,0 +1,207 @@
+/**
+ * @file boardkernel.hpp
+ * @brief Board update kernels specialized for common board sizes.
+ *
+ * This file defines the BoardKernel class template, which applies moves to a
+ * row-major board stored in a contiguous buffer. Sizes 3, 4, 5 and 8 get
+ * compile-time specializations whose loops are fully unrolled, every other
+ * size is handled by the generic BoardKernel<0> which takes the size at
+ * runtime. visitBoardKernel() picks the right kernel for a given size.
+ * Moves return how the number of cells not equal to 9 changed, so callers
+ * can track the win condition without scanning the board.
+ *
+ * @author Ignat Romanov
+ * @version 1.1
+ * @date 16.10.2026
+ */
+
+#include <utility>
+
+#ifndef BOARDKERNEL_HPP
+#define BOARDKERNEL_HPP
+
+/**
+ * @brief Increment a cell value by one. If value was 9, sets it to 1.
+ * @param value Cell value to increment.
+ * @return Change of the number of cells not equal to 9: 1 if value left 9, -1 if it reached 9, 0 otherwise.
+ */
+inline int incrementCell(int &value)
+{
+    int change = (value == 9) - (value == 8);
+    value = value >= 9 ? 1 : value + 1;
+    return change;
+}
+
+/**
+ * @brief Decrement a cell value by one. If value was 1, sets it to 9.
+ * @param value Cell value to decrement.
+ * @return Change of the number of cells not equal to 9: 1 if value left 9, -1 if it reached 9, 0 otherwise.
+ */
+inline int decrementCell(int &value)
+{
+    int change = (value == 9) - (value == 1);
+    value = value <= 1 ? 9 : value - 1;
+    return change;
+}
+
+/**
+ * @brief Move kernel for a board of compile-time size N. All loops are unrolled.
+ *
+ * @tparam N Number of rows and columns of the board. Zero selects the generic runtime-sized kernel.
+ */
+template <int N>
+class BoardKernel
+{
+public:
+    /**
+     * @brief Get number of rows and columns handled by the kernel.
+     * @return Size of the board.
+     */
+    constexpr int size() const { return N; }
+
+    /**
+     * @brief Increment all values in given row and column by one. The crossing cell is incremented once.
+     * @param board Row-major board of N*N values.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int increment(int *board, int row, int col) const
+    {
+        return incrementLines(board, row, col, std::make_integer_sequence<int, N>());
+    }
+
+    /**
+     * @brief Decrement all values in given row and column by one. The crossing cell is decremented once.
+     * @param board Row-major board of N*N values.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int decrement(int *board, int row, int col) const
+    {
+        return decrementLines(board, row, col, std::make_integer_sequence<int, N>());
+    }
+
+    /**
+     * @brief Check if all values of the board are 9.
+     * @param board Row-major board of N*N values.
+     * @return True if the board is won.
+     */
+    bool isSolved(const int *board) const
+    {
+        return allNines(board, std::make_integer_sequence<int, N * N>());
+    }
+
+private:
+    template <int... I>
+    static int incrementLines(int *board, int row, int col, std::integer_sequence<int, I...>)
+    {
+        int change = (incrementCell(board[row * N + I]) + ...);
+        change += (incrementCell(board[I * N + col]) + ...);
+        return change + decrementCell(board[row * N + col]); // Handle increment of the crossing cell twice.
+    }
+
+    template <int... I>
+    static int decrementLines(int *board, int row, int col, std::integer_sequence<int, I...>)
+    {
+        int change = (decrementCell(board[row * N + I]) + ...);
+        change += (decrementCell(board[I * N + col]) + ...);
+        return change + incrementCell(board[row * N + col]); // Handle decrement of the crossing cell twice.
+    }
+
+    template <int... I>
+    static bool allNines(const int *board, std::integer_sequence<int, I...>)
+    {
+        return ((board[I] == 9) & ...); // Branch-free, every cell is compared.
+    }
+};
+
+/**
+ * @brief Generic move kernel for a board of any size, stored in a contiguous row-major buffer.
+ */
+template <>
+class BoardKernel<0>
+{
+public:
+    /**
+     * @brief Constructs kernel for a board of given size.
+     * @param size Number of rows and columns of the board.
+     */
+    explicit BoardKernel(int size) : n(size) {}
+
+    int size() const { return n; }
+
+    int increment(int *board, int row, int col) const
+    {
+        int change = 0;
+        int *line = board + row * n;
+        for (int i = 0; i < n; ++i)
+        {
+            change += incrementCell(line[i]);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            change += incrementCell(board[i * n + col]);
+        }
+        return change + decrementCell(line[col]); // Handle increment of the crossing cell twice.
+    }
+
+    int decrement(int *board, int row, int col) const
+    {
+        int change = 0;
+        int *line = board + row * n;
+        for (int i = 0; i < n; ++i)
+        {
+            change += decrementCell(line[i]);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            change += decrementCell(board[i * n + col]);
+        }
+        return change + incrementCell(line[col]); // Handle decrement of the crossing cell twice.
+    }
+
+    bool isSolved(const int *board) const
+    {
+        for (int i = 0, cells = n * n; i < cells; ++i)
+        {
+            if (board[i] != 9)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    int n;
+};
+
+/**
+ * @brief Call visitor with the kernel best suited for a board size.
+ *
+ * Sizes 3, 4, 5 and 8 are dispatched to their unrolled specializations, all
+ * other sizes to the generic kernel.
+ *
+ * @param size Number of rows and columns of the board.
+ * @param visitor Callable taking a kernel by value.
+ * @return Value returned by the visitor.
+ */
+template <typename Visitor>
+decltype(auto) visitBoardKernel(int size, Visitor &&visitor)
+{
+    switch (size)
+    {
+    case 3:
+        return visitor(BoardKernel<3>());
+    case 4:
+        return visitor(BoardKernel<4>());
+    case 5:
+        return visitor(BoardKernel<5>());
+    case 8:
+        return visitor(BoardKernel<8>());
+    default:
+        return visitor(BoardKernel<0>(size));
+    }
+}
+
+#endif // BOARDKERNEL_HPP
@@ -0,0 +1,97 @@
+/**
+ * @file boardsymmetry.hpp
+ * @brief Header file for the BoardSymmetry class.
+ *
+ * This file contains the declaration of the BoardSymmetry class, which maps
+ * boards to a canonical form. Reordering rows, reordering columns and
+ * transposing a board map every move to a move and every solution to a
+ * solution, so a 3x3 board has up to 72 equivalent forms and an 8x8 board
+ * up to 8! * 8! * 2. All of them have the same canonical form, the
+ * lexicographically smallest one, so caches and dedupe passes keyed by it
+ * treat them as one board.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gamelogic.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#ifndef BOARDSYMMETRY_HPP
+#define BOARDSYMMETRY_HPP
+
+/**
+ * @brief Canonical form of boards under row and column reordering and transposition.
+ */
+class BoardSymmetry
+{
+public:
+    static constexpr int MAX_CANONICAL_SIZE = 8; // Largest board canonicalize() accepts, the search can branch on symmetric boards.
+
+    /**
+     * @brief Reordering of rows and columns, after an optional transposition, from a board to its canonical form.
+     * Canonical cell (i, j) is cell (rows[i], cols[j]) of the board, or cell (cols[j], rows[i]) if transposed.
+     */
+    struct Transform
+    {
+        bool transposed = false;
+        std::vector<int> rows; // Board row, or column if transposed, of every canonical row.
+        std::vector<int> cols; // Board column, or row if transposed, of every canonical column.
+    };
+
+    /**
+     * @brief Canonical form of a board.
+     */
+    struct Canonical
+    {
+        uint64_t key = 0;        // hashBoard() of values, equal for equivalent boards.
+        std::vector<int> values; // Row-major values of the canonical form.
+        Transform transform;     // Transform from the board to values.
+    };
+
+    /**
+     * @brief Find the canonical form of a board.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param size Number of rows and columns.
+     * @return Canonical form and the transform that gives it.
+     * @throw std::out_of_range if size is less than one or larger than MAX_CANONICAL_SIZE.
+     */
+    static Canonical canonicalize(const int *values, int size);
+
+    /**
+     * @brief Find the canonical form of the board of a game.
+     * @param game Game to read.
+     * @return Canonical form and the transform that gives it.
+     * @throw std::out_of_range if the board is larger than MAX_CANONICAL_SIZE.
+     */
+    static Canonical canonicalize(const GameLogic &game);
+
+    /**
+     * @brief Apply a transform to a board.
+     * @param transform Transform of a board of the same size.
+     * @param values Row-major array of size*size values.
+     * @param out Output of size*size row-major values, must not overlap values.
+     */
+    static void apply(const Transform &transform, const int *values, int *out);
+
+    /**
+     * @brief Map a move on a board to the same move on its canonical form.
+     * @param transform Transform of the board.
+     * @param move Move on the board.
+     * @return Move on the canonical form.
+     */
+    static GameLogic::Move toCanonical(const Transform &transform, GameLogic::Move move);
+
+    /**
+     * @brief Map a move on the canonical form back to the board, e.g. a hint found for the canonical form.
+     * @param transform Transform of the board.
+     * @param move Move on the canonical form.
+     * @return Move on the board.
+     */
+    static GameLogic::Move fromCanonical(const Transform &transform, GameLogic::Move move);
+};
+
+#endif // BOARDSYMMETRY_HPP
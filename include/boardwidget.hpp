@@ -0,0 +1,216 @@
+/**
+ * @file boardwidget.hpp
+ * @brief Widget that paints the whole game board with QPainter.
+ *
+ * The BoardWidget class shows the cells of a GameLogic board without a
+ * widget per cell, so boards up to MAX_SIZE rows and columns can be
+ * played, zoomed and panned. Cell colors are kept in an image with one
+ * pixel per cell, which is scaled to the zoom level when painted. Mouse
+ * positions are mapped to cells arithmetically, only cells whose value
+ * changed are repainted and the hover and hint highlights are drawn as
+ * overlays on top of the cells.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gamelogic.hpp"
+#include <QColor>
+#include <QImage>
+#include <QPointF>
+#include <QRectF>
+#include <QSize>
+#include <QWidget>
+#include <vector>
+
+#ifndef BOARDWIDGET_HPP
+#define BOARDWIDGET_HPP
+
+/**
+ * @class BoardWidget
+ * @brief Paints the board of a game and reports clicked cells.
+ *
+ * The widget only reads the game, moves are made by the owner in response
+ * to cellClicked(). The mouse wheel zooms around the cursor and dragging
+ * with the right or middle button pans the board.
+ */
+class BoardWidget : public QWidget
+{
+    Q_OBJECT
+public:
+    static constexpr double MAX_CELL_SIZE = 256; // Largest zoom, in pixels per cell.
+    static constexpr double GRID_CELL_SIZE = 6;  // Smallest zoom at which grid lines are drawn.
+    static constexpr double TEXT_CELL_SIZE = 16; // Smallest zoom at which values are drawn.
+
+    /**
+     * @brief Constructs an empty board widget.
+     *
+     * @param parent The parent widget.
+     */
+    explicit BoardWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief Set the game shown by the widget and show its whole board, fitted to the widget.
+     *
+     * @param game Game to show, must outlive the widget. nullptr shows nothing.
+     */
+    void setGame(const GameLogic *game);
+
+    /**
+     * @brief Read every cell of the game again and repaint the cells that changed.
+     * A new board size resets the zoom to fit the board. O(size*size).
+     */
+    void refresh();
+
+    /**
+     * @brief Read the row and column of a move again and repaint the cells that changed. O(size).
+     *
+     * @param move Move that was made or undone.
+     */
+    void refreshLines(GameLogic::Move move);
+
+    /**
+     * @brief Enable or disable the colors of cells.
+     *
+     * @param shown True to fill cells with a color per value, false for plain cells.
+     */
+    void setColorsShown(bool shown);
+
+    /**
+     * @brief Highlight a cell with a yellow frame, replacing the previous hint.
+     *
+     * @param move Cell to highlight.
+     */
+    void setHint(GameLogic::Move move);
+
+    /**
+     * @brief Remove the hint highlight.
+     */
+    void clearHint();
+
+    /**
+     * @brief Get the value shown in a cell, which is the game value as of the last refresh.
+     *
+     * @param move Cell of the board.
+     * @return Value in range [1, 9], 0 if the cell is outside the board.
+     */
+    int getShownValue(GameLogic::Move move) const;
+
+    /**
+     * @brief Get the cell under a position in the widget.
+     *
+     * @param position Position in widget coordinates.
+     * @return Cell of the board, {-1, -1} if there is no cell at the position.
+     */
+    GameLogic::Move cellAt(QPointF position) const;
+
+    /**
+     * @brief Get the area of a cell in the widget at the current zoom.
+     *
+     * @param move Cell of the board.
+     * @return Area in widget coordinates, may lie outside the visible part.
+     */
+    QRectF cellRect(GameLogic::Move move) const;
+
+    /**
+     * @brief Zoom around a fixed point, which stays over the same part of the board.
+     *
+     * @param cellSize New size of a cell in pixels, clamped between the size that fits the board and MAX_CELL_SIZE.
+     * @param anchor Point in widget coordinates.
+     */
+    void zoomTo(double cellSize, QPointF anchor);
+
+    /**
+     * @brief Get color of the cells with a value.
+     *
+     * @param value Cell value in range [1, 9].
+     * @return QColor rgb color in pastel colors, white for other values.
+     */
+    static QColor getColorForValue(int value);
+
+    QSize sizeHint() const override;
+
+signals:
+    /**
+     * @brief Emitted when a cell is clicked with the left button.
+     *
+     * @param move Clicked cell.
+     */
+    void cellClicked(GameLogic::Move move);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void leaveEvent(QEvent *event) override;
+    void changeEvent(QEvent *event) override;
+
+private:
+    /**
+     * @brief Store a value read from the game, setting the pixel of the cell.
+     *
+     * @param cell Index of the cell in row-major order.
+     * @param value Cell value.
+     * @return True if the value differs from the shown one.
+     */
+    bool storeValue(int cell, int value);
+
+    /**
+     * @brief Set the pixels of all cells from their values, used when colors are toggled or the board is resized.
+     */
+    void paintImage();
+
+    /**
+     * @brief Get the size of a cell at which the whole board fits into the widget.
+     *
+     * @return Size in pixels.
+     */
+    double fitCellSize() const;
+
+    /**
+     * @brief Keep the board over the widget: a board larger than the widget cannot be panned away, a smaller one is centered.
+     */
+    void clampOffset();
+
+    /**
+     * @brief Repaint the cells of a rectangle of the board.
+     *
+     * @param firstRow, firstCol First cell of the rectangle.
+     * @param lastRow, lastCol Last cell of the rectangle, included.
+     */
+    void updateCells(int firstRow, int firstCol, int lastRow, int lastCol);
+
+    /**
+     * @brief Repaint the row and column of a cell, where the hover overlay is drawn.
+     *
+     * @param move Cell, nothing is repainted if it is outside the board.
+     */
+    void updateLines(GameLogic::Move move);
+
+    /**
+     * @brief Move the hover overlay to another cell.
+     *
+     * @param move Cell under the mouse, {-1, -1} for none.
+     */
+    void setHovered(GameLogic::Move move);
+
+    const GameLogic *game;
+    int size;                          // Rows and columns of the shown board, 0 if there is no game.
+    std::vector<unsigned char> shown;  // Value shown in every cell in row-major order.
+    QImage cells;                      // One pixel per cell with the color of its value.
+    bool colorsShown;
+    double cellSize;                   // Zoom, in pixels per cell.
+    QPointF offset;                    // Board position at the top left corner of the widget, in pixels.
+    bool fitted;                       // True while the zoom follows the widget size.
+    GameLogic::Move hovered;           // Cell under the mouse, {-1, -1} for none.
+    GameLogic::Move hint;              // Cell highlighted by the hint, {-1, -1} for none.
+    GameLogic::Move pressed;           // Cell where the left button was pressed, {-1, -1} for none.
+    QPointF panFrom;                   // Last mouse position while panning.
+    bool panning;
+};
+
+#endif // BOARDWIDGET_HPP
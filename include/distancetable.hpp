@@ -0,0 +1,103 @@
+/**
+ * @file distancetable.hpp
+ * @brief Header file for the DistanceTable class.
+ *
+ * This file contains the declaration of the DistanceTable class, which gives
+ * the optimal distance of every 3x3 board from a precomputed file. A 3x3
+ * board is described by 9 cell values modulo 9, so there are 9^9 states.
+ * The file holds one entry per state and is memory-mapped lazily on the
+ * first query, so creating the table costs nothing at startup. If the file
+ * is missing or invalid, every query falls back to the Solver.
+ *
+ * File layout: 24-byte header (magic, version, board size, bits per entry,
+ * number of states) followed by one byte per state, indexed by
+ * DistanceTable::index().
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+
+#include "mappedfile.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#ifndef DISTANCETABLE_HPP
+#define DISTANCETABLE_HPP
+
+/**
+ * @brief Lookup table of optimal distances for all 3x3 boards.
+ */
+class DistanceTable
+{
+public:
+    static constexpr int SIZE = 3;                    // Board size covered by the table.
+    static constexpr uint64_t STATES = 387420489ULL;  // 9^9 boards.
+    static constexpr uint32_t MAGIC = 0x44395454;     // "TT9D"
+    static constexpr uint32_t VERSION = 1;            // File format version.
+    static constexpr std::size_t HEADER_BYTES = 24;   // Size of the file header.
+
+    /**
+     * @brief Constructs table backed by a file. The file is not opened until the first query.
+     * @param path Path of the table file written by DistanceTable::generate().
+     */
+    explicit DistanceTable(const std::string &path);
+
+    /**
+     * @brief Get optimal distance of a board. O(1) lookup, no heap allocation.
+     * @param board Row-major array of 9 cell values in range [1, 9].
+     * @return Minimum number of moves needed to win.
+     */
+    int distance(const int *board) const;
+
+    /**
+     * @brief Get a move that brings the board one move closer to the win, by probing the distances of the 9 following boards.
+     * @param board Row-major array of 9 cell values in range [1, 9].
+     * @return Row-major index of the cell to press, -1 if the board is already won.
+     */
+    int bestMove(const int *board) const;
+
+    /**
+     * @brief Map the file if it was not mapped yet and check that it is valid.
+     * @return True if queries are answered from the file, false if they fall back to the Solver.
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Get index of a board in the table: cell values modulo 9 read as a base-9 number, first cell lowest.
+     * @param board Row-major array of 9 cell values in range [1, 9].
+     * @return Index in range [0, STATES).
+     */
+    static uint32_t index(const int *board);
+
+    /**
+     * @brief Compute table entries for a range of indices.
+     * @param entries Output array, entries[i] receives the distance of index begin + i.
+     * @param begin First index.
+     * @param end One past the last index.
+     */
+    static void fill(unsigned char *entries, uint64_t begin, uint64_t end);
+
+    /**
+     * @brief Compute the whole table in parallel and write it to a file.
+     * @param path Path of the file to write.
+     * @param threads Number of worker threads.
+     * @return True if the file was written.
+     */
+    static bool generate(const std::string &path, int threads);
+
+private:
+    /**
+     * @brief Map the file and validate its header. Called once.
+     */
+    void load() const;
+
+    std::string path;
+    mutable std::once_flag loadFlag;
+    mutable MappedFile file;
+    mutable const unsigned char *entries; // First entry in the mapped file, nullptr if not loaded.
+};
+
+#endif // DISTANCETABLE_HPP
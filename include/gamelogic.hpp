@@ -9,16 +9,30 @@
  * according to the defined rules and provides a seamless experience for players.
  *
  * @author Ignat Romanov
- * @version 1.1
- * @date 20.11.2024
+ * @version 1.2
+ * @date 16.10.2026
  */
 
+#include "gamerandom.hpp"
+#include "lazyboard.hpp"
+#include "packedboard.hpp"
+#include "tiledboard.hpp"
+#include "solver.hpp"
 #include "stack.hpp"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #ifndef GAMELOGIC_HPP
 #define GAMELOGIC_HPP
 
-#define MAX_SIZE 3 // Max size of board.
+#define DEFAULT_SIZE 3 // Default size of board.
+#define MAX_SIZE 1024  // Max size of board.
+
+class DistanceTable;
+class HintCache;
+class MoveLogWriter;
 
 /**
  * @brief Provides the functionality for target 9 game.
@@ -33,9 +47,34 @@ public:
     };
 
     /**
-     * @brief Constructor for the class. Initializes board to default board size (3x3).
+     * @brief Copy of everything a hint needs. It does not change with the game, so it can be solved on another thread.
+     */
+    struct BoardSnapshot
+    {
+        int size = 0;
+        std::vector<int> values;                            // Row-major cell values.
+        std::shared_ptr<const DistanceTable> distanceTable; // Table of the game, may be empty.
+        std::shared_ptr<HintCache> hintCache;               // Cache of the game, may be empty.
+        uint64_t hash = 0;                                  // stateHash() of the board.
+    };
+
+    /**
+     * @brief Memory layout of the board.
      */
-    GameLogic();
+    enum class Storage
+    {
+        Dense,  // One int per cell, moves use size-specialized kernels. Default.
+        Packed, // 4 bits per cell, 16 cells per 64-bit word, moves use word-wide arithmetic.
+        Tiled,  // One byte per cell in 8x8 tiles of one cache line, columns of large boards cost the same as rows.
+        Lazy    // Start values plus row and column press counts, moves are O(1) and values are computed when read.
+    };
+
+    /**
+     * @brief Constructor for the class. Initializes board of given size with all values set to 9.
+     * @param size Number of rows and columns of the board. Default board size is 3x3.
+     * @throw std::out_of_range if size is less than one or larger than MAX_SIZE.
+     */
+    explicit GameLogic(int size = DEFAULT_SIZE);
 
     /**
      * @brief Default destructor.
@@ -43,7 +82,8 @@ public:
     ~GameLogic();
 
     /**
-     * @brief Check if the player won.
+     * @brief Check if the player won. O(1), the number of cells not equal to 9 is kept up to date by every move.
+     * In lazy storage the line sums rule out a win in O(1), the board is only read when every line sum is 0.
      * @return  True if the player won. False otherwise.
      */
     bool isWin();
@@ -52,10 +92,27 @@ public:
      * @brief Make a move in the game. Increments all values in given row and column by one. If value in board was 9, sets it to 1.
      * @param move move of struct Move containing row and col members. {row, col}.
      * @param value Value by which to make move. Default value is one.
-     * @throw std::out_of_range if the move is bigger than dimensions of a square array defined by MAX_SIZE.
+     * @throw std::out_of_range if the move is bigger than dimensions of the board.
      */
     void makeMove(Move move);
 
+    /**
+     * @brief Make a list of moves as one batch. Moves commute, so the whole list is applied as press counts per row and column
+     * in O(size*size) per checkpoint interval instead of walking a row and a column for every move.
+     * Board, history and number of moves are the same as after calling GameLogic::makeMove() for each move.
+     * @param moves Array of moves in the order they are played.
+     * @param count Number of moves in the array.
+     * @throw std::out_of_range if any move is outside the board, nothing is changed in that case.
+     */
+    void makeMoves(const Move *moves, std::size_t count);
+
+    /**
+     * @brief Make a list of moves as one batch, see GameLogic::makeMoves(const Move *, std::size_t).
+     * @param moves Moves in the order they are played.
+     * @throw std::out_of_range if any move is outside the board.
+     */
+    void makeMoves(const std::vector<Move> &moves);
+
     /**
      * @brief Getter function to get a value from the board.
      * @param move move of struct Move containing row and col members. {row, col}.
@@ -65,15 +122,80 @@ public:
     int getBoardValue(Move move) const;
 
     /**
-     * @brief Initializes game with the set difficulty. Substracts 1 from random rows and columns.
-     * @throw std::out_of_range if difficulty is bigger than MAX_SIZE*MAX_SIZE
+     * @brief Get the Zobrist hash of the board, see boardhash.hpp. Equal boards have equal hashes in every game.
+     * The first call after a new board scans it, then every move updates the hash in O(size) as its row and column change.
+     * In lazy storage moves stay O(1) and the hash is recomputed when asked after a move.
+     * @return Hash of the size and values of the board, the same as hashBoard() of the values.
+     */
+    uint64_t stateHash() const;
+
+    /**
+     * @brief Initializes game with the set difficulty. The board is built from random press counts whose sum is the difficulty
+     * and which are the minimal solution of the board, so the optimal number of moves is exactly the difficulty. O(size*size).
+     * For sizes 10, 19, 28, ... (size % 9 == 1) minimality is not guaranteed and the board may be solvable in fewer moves.
+     * The board comes from the seed set with setSeed(), or from a new random seed if none was set since the last init().
+     * @throw std::out_of_range if difficulty is bigger than size*size
      */
     void init();
 
+    /**
+     * @brief Set the seed of the board built by the next init(). The same seed, size, difficulty, stream and engine always give the same board.
+     * @param seed Seed to use, e.g. one shared from getSeed() of another game.
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * @brief Get the seed of the current board, or of the next board if it was set with setSeed() after the last init().
+     * @return Seed.
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Choose the random stream and engine for boards built by init(). Games with different streams and the same seed
+     * get independent boards, so threads can generate reproducible puzzles without sharing state.
+     * @param stream Index of the stream, 0 by default.
+     * @param engine Random engine. Philox by default, its streams never overlap.
+     */
+    void setRandomStream(uint64_t stream, GameRandom::Engine engine = GameRandom::Engine::Philox);
+
+    /**
+     * @brief Start a new game from given board values instead of a random board. History is cleared.
+     * @param values Row-major board of size*size values in range [1, 9].
+     * @param seed Seed reported by getSeed() for this board, e.g. the seed of a replayed log.
+     * @throw std::out_of_range if a value is not in range [1, 9].
+     */
+    void setBoard(const int *values, uint64_t seed = 0);
+
+    /**
+     * @brief Sets board size. The board is reset to all values 9 and history is cleared, call GameLogic::init() to start a new game.
+     * Difficulty is lowered to size*size if it does not fit the new board.
+     * @param size Number of rows and columns of the board.
+     * @throw std::out_of_range if size is less than one or larger than MAX_SIZE.
+     */
+    void setSize(int size);
+
+    /**
+     * @brief Get number of rows and columns of the board.
+     * @return Size of the board.
+     */
+    int getSize() const;
+
+    /**
+     * @brief Switch the memory layout of the board. Values, history and game state are kept.
+     * @param storage New storage of the board.
+     */
+    void setStorage(Storage storage);
+
+    /**
+     * @brief Get current memory layout of the board.
+     * @return Storage of the board.
+     */
+    Storage getStorage() const;
+
     /**
      * @brief Sets difficulty to specified value.
      * @param difficulty difficulty to set.
-     * @throw std::out_of_range if new difficulty is larger than MAX_SIZE*MAX_SIZE or difficulty is less than or equal to zero.
+     * @throw std::out_of_range if new difficulty is larger than size*size or difficulty is less than or equal to zero.
      */
     void setDifficulty(int difficulty);
 
@@ -89,12 +211,33 @@ public:
      */
     void undoMove();
 
+    /**
+     * @brief Undo several last moves at once. The moves can be redone. Cost does not grow with the number of moves.
+     * @param count Number of moves to undo.
+     * @throw std::runtime_error if count is negative, larger than number of moves or moves cannot be undone.
+     */
+    void undoMoves(int count);
+
     /**
      * @brief Redo function to play last move again and increment number of moves by one.
      * @throw std::runtime_error if cannot redo move.
      */
     void redoMove();
 
+    /**
+     * @brief Jump to any position in the move history, as if moves were undone or redone up to it.
+     * The board is rebuilt from the nearest checkpoint with aggregated press counts, so the cost is bounded by the board size, not by the distance in history.
+     * @param moveIndex Number of moves from the start of the game, in range [0, GameLogic::getHistorySize()].
+     * @throw std::out_of_range if moveIndex is outside the history.
+     */
+    void seekTo(int moveIndex);
+
+    /**
+     * @brief Get number of moves in history, including moves that can be redone.
+     * @return Number of moves from the start of the game to the last move that can be redone.
+     */
+    int getHistorySize() const;
+
     /**
      * @brief Get number of moves from num_moves.
      * @return Number of moves.
@@ -120,14 +263,117 @@ public:
     bool isCanHint() const;
 
     /**
-     * @brief Determine the best next move and return it.
+     * @brief Determine the best next move and return it. The move is taken from the exact minimum-press solution of the board.
      * @return Best next move of struct GameLogic::Move.
      * @throw std::runtime_error if cannot hint a move, e.g. when game is finished or not initialized.
      */
     Move hintNextMove() const;
 
+    /**
+     * @brief Take a snapshot of the board for GameLogic::hintMove(). O(size*size).
+     * @return Copy of the board and the distance table.
+     * @throw std::runtime_error if hinting is not allowed at this time, see isCanHint().
+     */
+    BoardSnapshot snapshotBoard() const;
+
+    /**
+     * @brief Determine the best next move of a snapshot, the same move hintNextMove() returns for that board.
+     * Does not touch any game, so it can run on a worker thread while the game goes on.
+     * @param snapshot Board to hint.
+     * @param monitor Optional progress and cancellation of the solve.
+     * @return Best next move, {-1, -1} if the monitor cancelled the search.
+     * @throw std::runtime_error if the board is already solved or has no solution.
+     */
+    static Move hintMove(const BoardSnapshot &snapshot, Solver::Monitor *monitor = nullptr);
+
+    /**
+     * @brief Generate the board init() starts from, without a game, e.g. for batches of boards.
+     * @param size Board size.
+     * @param difficulty Number of presses undone from a won board, at most size * size.
+     * @param random Generator made from the seed, stream and engine of the board.
+     * @param board Output of size * size row-major values.
+     */
+    static void generateBoard(int size, int difficulty, GameRandom &random, int *board);
+
+    /**
+     * @brief Get the optimal number of moves left to win from the current board.
+     * @return Minimum number of moves needed to set all values to 9. Zero if the board is already won, -1 if it cannot be won.
+     * For board sizes where Solver::isExact() is false the number is an upper bound.
+     */
+    int getOptimalDistance() const;
+
+    /**
+     * @brief Score every cell for a heatmap: how many times it is pressed in the optimal solution of the current board.
+     * Uses the row and column sums kept up to date by every move, so all cells are scored in O(size*size).
+     * @return Row-major vector of size*size press counts in range [0, 8], all zeros on a won board.
+     * @throw std::runtime_error if the board has no solution.
+     */
+    std::vector<int> scoreCells() const;
+
+    /**
+     * @brief Save the whole game state to a snapshot file: board, number of moves, difficulty, seed, history and its
+     * checkpoints. Sections are stored flat, in the layout GameLogic keeps in memory, so loadSnapshot() only copies them.
+     * The file is written next to path, flushed to the disk and renamed, so a crash never leaves a half-written snapshot.
+     * @param path Path of the snapshot file.
+     * @return True if the snapshot was written.
+     */
+    bool saveSnapshot(const std::string &path) const;
+
+    /**
+     * @brief Restore the game state saved with saveSnapshot(). The file is memory-mapped and its sections are copied
+     * without parsing, restoring a history of a million moves takes a few milliseconds. Checkpoints are checked against the
+     * board and the history first, in one pass over the history. A move log is not resumed, see resumeMoveLog().
+     * @param path Path of the snapshot file.
+     * @return True if the game was restored, false if the file is missing or not a valid snapshot. The game is unchanged then.
+     */
+    bool loadSnapshot(const std::string &path);
+
+    /**
+     * @brief Record the game to a move log file, see MoveLogWriter. The current board is the start of the log and the history
+     * is cleared, so the log can always be replayed. Recording stops at the next init(), setBoard() or setSize().
+     * @param path Path of the log file, created or truncated.
+     * @param keepHistory True to keep the history instead: the log starts at the board before the first move, then holds
+     * every move of the history and a seek back to the current one, so a replay can undo and redo the same moves.
+     * @return True if the file was created.
+     */
+    bool startMoveLog(const std::string &path, bool keepHistory = false);
+
+    /**
+     * @brief Continue recording to a move log of this game written earlier, e.g. after loadSnapshot() in a new run.
+     * The log must replay to the current board and history, otherwise it is left unchanged.
+     * @param path Path of the log file.
+     * @return True if the log matches the game and was opened for appending.
+     */
+    bool resumeMoveLog(const std::string &path);
+
+    /**
+     * @brief Write the remaining events of the move log and close it. Does nothing if no log is recorded.
+     */
+    void stopMoveLog();
+
+    /**
+     * @brief Use a precomputed table for hints and distances on 3x3 boards. Other sizes keep using the Solver.
+     * @param table Table to use, nullptr to always use the Solver.
+     */
+    void setDistanceTable(std::shared_ptr<const DistanceTable> table);
+
+    /**
+     * @brief Reuse hints and distances of boards solved before, by this game or any other game sharing the cache.
+     * Entries are keyed by the whole board, so they stay correct across moves, init() and size changes.
+     * Boards answered by the distance table and boards smaller than 4x4, which solve faster than a lookup,
+     * do not use the cache.
+     * @param cache Cache to use, nullptr to always solve.
+     */
+    void setHintCache(std::shared_ptr<HintCache> cache);
+
 private:
-    int board[MAX_SIZE][MAX_SIZE];
+    int size;               // Number of rows and columns.
+    Storage storage;        // Which of board, packed, tiled and lazy holds the cells.
+    std::vector<int> board; // Row-major board of size*size values, empty in other storages.
+    PackedBoard packed;     // Packed board, empty in other storages.
+    TiledBoard tiled;       // Tiled board, empty in other storages.
+    LazyBoard lazy;         // Lazy board, empty in other storages.
+    int unsolved;           // Number of cells not equal to 9, the game is won when it is zero. Not kept in lazy storage.
     int num_moves;
     int current_difficulty;
     bool canRedo;
@@ -149,8 +395,151 @@ private:
      */
     void redoMakeMove(Move move);
 
-    Stack<Move> historyMoves; // Undo stack
-    Stack<Move> undoHistory;  // Redo stack
+    /**
+     * @brief Check that move is inside the board.
+     * @param move Move to check.
+     * @return True if row and column are in range [0, size).
+     */
+    bool isInside(Move move) const;
+
+    /**
+     * @brief Solve the current board into GameLogic::solution, unless it was solved since the last change.
+     * @return Number of moves left in the solution.
+     */
+    int solve() const;
+
+    /**
+     * @brief Get the best move and moves left from the hint cache, or solve the board and cache them.
+     * The hint cache must be set.
+     * @param move Output of the best move, {-1, -1} if the board is solved or has no solution.
+     * @return Number of moves left, -1 if the board has no solution.
+     */
+    int cachedHint(Move &move) const;
+
+    /**
+     * @brief Increment values in given row and column in the current storage.
+     * @param move Move to apply, must be inside the board.
+     */
+    void incrementBoard(Move move);
+
+    /**
+     * @brief Decrement values in given row and column in the current storage.
+     * @param move Move to apply, must be inside the board.
+     */
+    void decrementBoard(Move move);
+
+    /**
+     * @brief Resize the current storage to size*size cells and set all values to 9.
+     */
+    void resetBoard();
+
+    /**
+     * @brief Update the row and column deficit sums after a move in O(1).
+     * @param move Move that was applied.
+     * @param reverse True if the move was undone instead of played.
+     */
+    void shiftLines(Move move, bool reverse);
+
+    /**
+     * @brief Update the hash for the row and column of a move in O(size). Called before the values change.
+     * @param move Move that is applied.
+     * @param reverse True if the move is undone instead of played.
+     */
+    void hashLines(Move move, bool reverse);
+
+    /**
+     * @brief Recompute the row and column deficit sums of a whole board.
+     * @param values Row-major board of size*size values in range [1, 9].
+     */
+    void countLines(const int *values);
+
+    /**
+     * @brief Count cells not equal to 9 by scanning the whole board.
+     * @return Number of cells.
+     */
+    int countUnsolved() const;
+
+    /**
+     * @brief Check if all values are 9 without changing the action flags, unlike GameLogic::isWin().
+     * @return True if the board is solved.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief Copy values of the board in row-major order, whatever the storage.
+     * @param cells Output array of size*size values.
+     */
+    void copyBoard(int *cells) const;
+
+    /**
+     * @brief Apply moves of history in range [first, last) to a board at once.
+     * @param values Row-major board of size*size values in range [1, 9], updated in place.
+     * @param first Index of the first move in history.
+     * @param last Index after the last move in history.
+     * @param reverse True to undo the moves instead of playing them.
+     */
+    void pressHistory(int *values, int first, int last, bool reverse) const;
+
+    /**
+     * @brief Replace values of the board in the current storage.
+     * @param values Row-major board of size*size values in range [1, 9].
+     */
+    void loadBoard(const int *values);
+
+    /**
+     * @brief Start a new history from the current board: clear moves and keep the board as the first checkpoint.
+     */
+    void resetHistory();
+
+    /**
+     * @brief Save the current board as a checkpoint if the number of moves is a multiple of the checkpoint interval.
+     */
+    void saveCheckpoint();
+
+    /**
+     * @brief Log a jump from the current move to another one, as one seek event or as single undos or redos, whichever is shorter.
+     * @param moveIndex Number of moves from the start of the history after the jump.
+     */
+    void logSeek(int moveIndex);
+
+    Stack<Move> history; // All moves of the game in order, moves from num_moves on can be redone.
+
+    std::vector<unsigned char> checkpoints; // Board values after every checkpointInterval moves of history, size*size per checkpoint.
+    int checkpointInterval;                 // Moves between checkpoints, at least size*size so saving is O(1) per move on average.
+
+    // A move lowers the deficit (9 - value modulo 9) of every cell in its row and column by one, so the deficit sum
+    // of its row and column drops by size and of every other line by one. The sum of line i is
+    // rowDeficits[i] - lineShift modulo 9, every move only touches one row, one column and lineShift.
+    std::vector<int> rowDeficits; // Deficit sum of every row modulo 9, before subtracting lineShift.
+    std::vector<int> colDeficits; // Deficit sum of every column modulo 9, before subtracting lineShift.
+    int lineShift;                // Moves applied since the sums were counted, modulo 9.
+
+    // Lines per value of rowDeficits and colDeficits. A won board has every line sum 0, i.e. all size rows and
+    // columns at lineShift, which isWin() checks in O(1) in lazy storage before reading the board.
+    std::vector<int> rowDeficitCounts; // Rows per value of rowDeficits, 9 entries.
+    std::vector<int> colDeficitCounts; // Columns per value of colDeficits, 9 entries.
+
+    mutable std::vector<int> solution; // Press counts of the last solved board, reused between hints.
+    mutable bool solutionValid;        // True if solution belongs to the current board.
+    mutable int solutionDistance;      // Moves left in solution.
+    mutable std::vector<int> lineSums; // Row then column deficit sums passed to the solver.
+    mutable std::vector<int> unpacked;   // Unpacked copy of the board for the solver and for batches of moves.
+    mutable std::vector<int> rowPresses; // Press counts per row of a batch of moves.
+    mutable std::vector<int> colPresses; // Press counts per column of a batch of moves.
+
+    mutable uint64_t hash;  // Zobrist hash of the board, valid if hashValid.
+    mutable bool hashValid; // True if hash belongs to the current board, moves keep it up to date outside lazy storage.
+
+    std::shared_ptr<const DistanceTable> distanceTable; // Lookup table for 3x3 boards, may be nullptr.
+    std::shared_ptr<HintCache> hintCache;               // Hints of boards solved before, may be nullptr.
+
+    GameRandom seeds;               // Draws the seeds of new games when none was set, seeded once from std::random_device.
+    uint64_t seed;                  // Seed of the current board, or of the next one if seedSet.
+    bool seedSet;                   // True if the next init() uses seed instead of drawing a new one.
+    uint64_t randomStream;          // Stream of the boards.
+    GameRandom::Engine randomEngine; // Engine of the boards.
+
+    std::unique_ptr<MoveLogWriter> moveLog; // Log of the game, nullptr if not recorded.
 };
 
 #endif // GAMELOGIC_HPP
@@ -0,0 +1,94 @@
+/**
+ * @file gamerandom.hpp
+ * @brief Header file for the GameRandom class.
+ *
+ * This file contains the declaration of the GameRandom class, a seedable
+ * random number generator used to build puzzles. Two engines are available:
+ * xoshiro256** is the fast default, Philox4x32-10 is counter-based, so every
+ * (seed, stream) pair is a disjoint sequence and threads can generate
+ * reproducible puzzles without sharing any state.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <cstdint>
+
+#ifndef GAMERANDOM_HPP
+#define GAMERANDOM_HPP
+
+/**
+ * @brief Seedable random number generator with independent streams.
+ *
+ * Satisfies UniformRandomBitGenerator, so it works with the distributions
+ * of <random>. The same seed, stream and engine always give the same
+ * sequence on every platform.
+ */
+class GameRandom
+{
+public:
+    /**
+     * @brief Algorithm producing the numbers.
+     */
+    enum class Engine
+    {
+        Xoshiro, // xoshiro256**, streams are derived by mixing the stream into the seed. Default.
+        Philox   // Philox4x32-10, the stream is part of the counter, so streams never overlap.
+    };
+
+    using result_type = uint64_t;
+
+    /**
+     * @brief Constructs a generator.
+     * @param seed Seed of the sequence.
+     * @param stream Index of an independent sequence for the same seed, e.g. a thread index.
+     * @param engine Algorithm to use.
+     */
+    explicit GameRandom(uint64_t seed = 0, uint64_t stream = 0, Engine engine = Engine::Xoshiro);
+
+    /**
+     * @brief Restart the generator from a seed, keeping its engine.
+     * @param seed Seed of the sequence.
+     * @param stream Index of an independent sequence for the same seed.
+     */
+    void seed(uint64_t seed, uint64_t stream = 0);
+
+    /**
+     * @brief Get the algorithm of the generator.
+     * @return Engine.
+     */
+    Engine getEngine() const;
+
+    /**
+     * @brief Get next random number.
+     * @return Uniformly distributed 64-bit value.
+     */
+    result_type operator()();
+
+    /**
+     * @brief Get a uniformly distributed number in range [0, bound), without modulo bias.
+     * @param bound Upper bound, must be positive.
+     * @return Random number less than bound.
+     */
+    uint64_t below(uint64_t bound);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+private:
+    /**
+     * @brief Encrypt the next Philox counter and buffer both 64-bit halves of the block.
+     */
+    void nextBlock();
+
+    Engine engine;
+    uint64_t state[4]; // xoshiro256** state.
+    uint64_t key;      // Philox key, the seed.
+    uint64_t stream;   // Philox stream, upper half of the counter.
+    uint64_t counter;  // Philox block index, lower half of the counter.
+    uint64_t block[2]; // Philox output of the last block.
+    int used;          // Values of block already returned.
+};
+
+#endif // GAMERANDOM_HPP
@@ -0,0 +1,233 @@
+/**
+ * @file gameserver.hpp
+ * @brief Header file for the GameServer class.
+ *
+ * This file contains the declaration of the GameServer class, which hosts
+ * many independent game sessions for headless clients such as bots and
+ * web bridges. Sessions are spread over a fixed pool of worker threads by
+ * their id, every worker owns its sessions and runs their commands in the
+ * order they were submitted, so sessions need no locks. The server does
+ * not depend on Qt or on a transport, see ServerProtocol and target9-server.
+ * All sessions share one HintCache, so openings hinted in one session are
+ * answered from the cache in the others. Clients are not trusted: Limits
+ * caps the sessions, their cells, the board size, the moves in the
+ * history of a session and the requests waiting on a worker.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gamelogic.hpp"
+#include "hintcache.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef GAMESERVER_HPP
+#define GAMESERVER_HPP
+
+/**
+ * @brief Runs commands on game sessions on a pool of worker threads.
+ */
+class GameServer
+{
+public:
+    /**
+     * @brief Commands of the protocol, the values are used by the binary protocol.
+     */
+    enum class Command : uint8_t
+    {
+        New = 1,   // Start a session with a new board.
+        Move = 2,  // Make a move.
+        Undo = 3,  // Undo the last move.
+        Redo = 4,  // Redo the last undone move.
+        Hint = 5,  // Get the best next move.
+        State = 6, // Get the board.
+        Close = 7, // End a session and free its memory.
+    };
+
+    /**
+     * @brief Command sent by a client.
+     */
+    struct Request
+    {
+        Command command = Command::State;
+        uint32_t tag = 0;        // Echoed in the response, lets clients match responses, which may arrive out of order.
+        uint64_t session = 0;    // Session of the command, ignored by New.
+        int row = 0;             // Cell of Move.
+        int col = 0;
+        int size = DEFAULT_SIZE; // Board size of New.
+        int difficulty = 1;      // Difficulty of New.
+        bool seeded = false;     // True if New plays the board of seed instead of a random one.
+        uint64_t seed = 0;
+    };
+
+    /**
+     * @brief Result of a command.
+     */
+    struct Response
+    {
+        Command command = Command::State;
+        uint32_t tag = 0;
+        bool ok = true;
+        std::string error;                 // Reason of the failure if ok is false.
+        uint64_t session = 0;
+        int moves = 0;                     // Moves made on the board.
+        bool won = false;                  // True if all cells are 9.
+        int row = -1;                      // Cell of Hint.
+        int col = -1;
+        int size = 0;                      // Board size, set by New and State.
+        uint64_t seed = 0;                 // Seed of the board, set by New and State.
+        std::vector<unsigned char> board;  // Row-major cell values, set by New and State.
+    };
+
+    /**
+     * @brief Resources clients may use, 0 for no limit.
+     */
+    struct Limits
+    {
+        std::size_t maxSessions = 1 << 16; // Open sessions of all clients.
+        std::size_t maxCells = 1 << 24;    // Cells of all open sessions.
+        int maxSize = 256;                 // Board size of New.
+        std::size_t maxQueue = 4096;       // Requests waiting on a worker, submit() blocks while it is full.
+        std::size_t maxHistory = 1 << 20;  // Moves in the undo history of one session, about 9 bytes each.
+    };
+
+    /**
+     * @brief Receives the response to a request. Called on a worker thread, responses of different sessions
+     * may be delivered concurrently and in any order.
+     */
+    using Reply = std::function<void(const Response &response)>;
+
+    /**
+     * @brief Starts the worker threads.
+     * @param workers Number of worker threads, at least one.
+     * @param hintCacheBytes Memory budget of the hint cache shared by all sessions, 0 to solve every hint.
+     */
+    explicit GameServer(int workers, std::size_t hintCacheBytes = HintCache::DEFAULT_BUDGET);
+
+    /**
+     * @brief Starts the worker threads.
+     * @param workers Number of worker threads, at least one.
+     * @param hintCacheBytes Memory budget of the hint cache shared by all sessions, 0 to solve every hint.
+     * @param limits Resources clients may use, New requests over them fail.
+     */
+    GameServer(int workers, std::size_t hintCacheBytes, const Limits &limits);
+
+    /**
+     * @brief Runs all submitted requests and joins the workers.
+     */
+    ~GameServer();
+
+    GameServer(const GameServer &) = delete;
+    GameServer &operator=(const GameServer &) = delete;
+
+    /**
+     * @brief Queue a request on the worker that owns its session. Thread-safe. Returns immediately unless the
+     * queue of the worker is full, then it waits for room, so a client reading its requests on the calling
+     * thread is not read from while its requests are behind. Must not be called from a Reply.
+     * Requests of one session are run in the order they were submitted.
+     * @param request Command to run.
+     * @param reply Function receiving the response.
+     */
+    void submit(const Request &request, Reply reply);
+
+    /**
+     * @brief Run a request on the calling thread. Only for use while no other thread submits requests, e.g. in tests.
+     * @param request Command to run.
+     * @return Response of the command.
+     */
+    Response execute(const Request &request);
+
+    /**
+     * @brief Get number of open sessions.
+     * @return Number of sessions.
+     */
+    std::size_t getSessionCount() const;
+
+    /**
+     * @brief Get number of cells of all open sessions.
+     * @return Number of cells.
+     */
+    std::size_t getCellCount() const;
+
+    /**
+     * @brief Get the resources clients may use.
+     * @return Limits of the server.
+     */
+    const Limits &getLimits() const;
+
+    /**
+     * @brief Get number of worker threads.
+     * @return Number of workers.
+     */
+    int getWorkerCount() const;
+
+    /**
+     * @brief Get counters of the hint cache shared by all sessions. Thread-safe.
+     * @return Counters, all zero if the cache is disabled.
+     */
+    HintCache::Stats getHintCacheStats() const;
+
+private:
+    /**
+     * @brief Worker thread with its queue and the sessions it owns.
+     */
+    struct Worker
+    {
+        std::mutex lock;
+        std::condition_variable wake;
+        std::condition_variable room; // Notified when the worker takes its queue.
+        std::deque<std::pair<Request, Reply>> queue;
+        std::unordered_map<uint64_t, std::unique_ptr<GameLogic>> sessions; // Only touched by the worker thread.
+        bool stopping = false;
+        std::thread thread;
+    };
+
+    /**
+     * @brief Run queued requests until the server is destroyed.
+     * @param worker Worker of the calling thread.
+     */
+    void work(Worker &worker);
+
+    /**
+     * @brief Run a request on a session of a worker.
+     * @param worker Worker that owns the session.
+     * @param request Command to run.
+     * @return Response of the command, with ok set to false if it failed.
+     */
+    Response run(Worker &worker, const Request &request);
+
+    /**
+     * @brief Count a new session and its cells against the limits.
+     * @param cells Cells of the session.
+     * @throw std::length_error if the session or its cells are over the limits, nothing is counted then.
+     */
+    void reserve(std::size_t cells);
+
+    /**
+     * @brief Get worker that owns a session.
+     * @param session Id of the session.
+     * @return Worker of the session.
+     */
+    Worker &owner(uint64_t session) const;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<uint64_t> lastSession; // Id of the last created session, ids start at 1.
+    std::atomic<std::size_t> sessions; // Number of open sessions.
+    std::atomic<std::size_t> cells;    // Cells of the open sessions.
+    Limits limits;
+    std::shared_ptr<HintCache> hintCache; // Shared by all sessions, nullptr if disabled.
+};
+
+#endif // GAMESERVER_HPP
@@ -0,0 +1,173 @@
+/**
+ * @file hintcache.hpp
+ * @brief Header file for the HintCache class.
+ *
+ * This file contains the declaration of the HintCache class, which keeps the
+ * best move and distance of recently hinted boards. Players ask for hints on
+ * the same positions again after undoing moves, and server sessions share
+ * openings, so a hint found once is reused instead of solving the board
+ * again. Entries are looked up by GameLogic::stateHash() and hold a packed
+ * copy of the board, a hash collision is a miss and never returns the hint
+ * of another board. The cache is split into shards, each with its own lock
+ * and LRU list, and holds at most a memory budget of entries.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef HINTCACHE_HPP
+#define HINTCACHE_HPP
+
+/**
+ * @brief Thread-safe, size-bounded LRU cache of hints keyed by board state.
+ */
+class HintCache
+{
+public:
+    static constexpr std::size_t DEFAULT_BUDGET = 64 << 20; // Default memory budget in bytes.
+    static constexpr int DEFAULT_SHARDS = 16;                // Default number of independently locked parts.
+
+    /**
+     * @brief Best move and number of moves left of a board.
+     */
+    struct Hint
+    {
+        int row = -1; // Cell to press, -1 if distance is not positive.
+        int col = -1;
+        int distance = -1; // Moves left, 0 if solved, -1 if the board has no solution.
+    };
+
+    /**
+     * @brief Counters of the cache.
+     */
+    struct Stats
+    {
+        uint64_t hits = 0;      // Lookups that found their board.
+        uint64_t misses = 0;    // Lookups that did not.
+        uint64_t evictions = 0; // Entries dropped to stay within the budget.
+        std::size_t entries = 0;
+        std::size_t bytes = 0; // Estimated memory of the entries.
+    };
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param budget Memory budget in bytes, split evenly over the shards. 0 keeps nothing.
+     * @param shards Number of shards, at least one. One shard gives exact LRU order.
+     * @throw std::invalid_argument if shards is less than one.
+     */
+    explicit HintCache(std::size_t budget = DEFAULT_BUDGET, int shards = DEFAULT_SHARDS);
+
+    HintCache(const HintCache &) = delete;
+    HintCache &operator=(const HintCache &) = delete;
+
+    /**
+     * @brief Look up the hint of a board and mark it as recently used. Thread-safe.
+     * @param key Hash of the board, see hashBoard().
+     * @param size Number of rows and columns.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param hint Output of the hint if found.
+     * @return True if the board is cached.
+     */
+    bool find(uint64_t key, int size, const int *values, Hint &hint);
+
+    /**
+     * @brief Store the hint of a board, replacing any entry with the same key, and evict the least recently
+     * used entries of its shard that no longer fit. Entries larger than the budget of a shard are not stored.
+     * Thread-safe.
+     * @param key Hash of the board, see hashBoard().
+     * @param size Number of rows and columns.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param hint Hint of the board.
+     */
+    void insert(uint64_t key, int size, const int *values, const Hint &hint);
+
+    /**
+     * @brief Change the memory budget, evicting entries that no longer fit. Thread-safe.
+     * @param budget Memory budget in bytes.
+     */
+    void setBudget(std::size_t budget);
+
+    /**
+     * @brief Get the memory budget.
+     * @return Budget in bytes.
+     */
+    std::size_t getBudget() const;
+
+    /**
+     * @brief Drop all entries. Counters are kept. Thread-safe.
+     */
+    void clear();
+
+    /**
+     * @brief Get the counters. Thread-safe, shards are read one after another.
+     * @return Counters.
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Get the estimated memory of an entry, e.g. to size a budget.
+     * @param size Number of rows and columns of the board.
+     * @return Bytes counted against the budget.
+     */
+    static std::size_t entryBytes(int size);
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        std::string board; // Size and values, two values per byte.
+        Hint hint;
+        std::size_t bytes; // Counted against the budget, see entryBytes().
+    };
+
+    /**
+     * @brief Independently locked part of the cache.
+     */
+    struct Shard
+    {
+        mutable std::mutex lock;
+        std::list<Entry> order; // Most recently used first.
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+        std::size_t bytes = 0;
+    };
+
+    /**
+     * @brief Pack a board for storing and comparing.
+     * @param size Number of rows and columns.
+     * @param values Row-major array of size*size values.
+     * @return Packed board.
+     */
+    static std::string packBoard(int size, const int *values);
+
+    /**
+     * @brief Drop least recently used entries of a shard until it fits a budget. The shard must be locked.
+     * @param shard Shard to shrink.
+     * @param limit Budget of the shard in bytes.
+     */
+    void evict(Shard &shard, std::size_t limit);
+
+    /**
+     * @brief Get the shard of a key.
+     * @param key Hash of a board.
+     * @return Shard holding the key.
+     */
+    Shard &shardOf(uint64_t key);
+
+    std::vector<Shard> shards;
+    std::atomic<std::size_t> budget;
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> evictions;
+};
+
+#endif // HINTCACHE_HPP
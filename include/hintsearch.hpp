@@ -0,0 +1,117 @@
+/**
+ * @file hintsearch.hpp
+ * @brief Header file for the HintSearch class.
+ *
+ * This file contains the declaration of the HintSearch class, which finds
+ * hints on a worker thread. A search works on a snapshot of the board, so
+ * the game can go on while it runs, reports its progress and is cancelled
+ * by the next search or by cancel(). The class does not depend on Qt.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gamelogic.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#ifndef HINTSEARCH_HPP
+#define HINTSEARCH_HPP
+
+/**
+ * @brief Runs one hint search at a time on its own worker thread.
+ */
+class HintSearch
+{
+public:
+    /**
+     * @brief Receives the percent done of a search. Called on the worker thread.
+     * @param search Id of the search returned by start().
+     * @param percent Percent done in range [0, 100], grows with every call.
+     */
+    using Progress = std::function<void(uint64_t search, int percent)>;
+
+    /**
+     * @brief Receives the result of a search that was not cancelled. Called on the worker thread.
+     * A search cancelled while it finishes may still report, and a result queued to another thread may arrive after
+     * the next start() or cancel(), callers drop results for which isCurrent() is false when they arrive.
+     * @param search Id of the search returned by start().
+     * @param move Best next move, {-1, -1} if the board is already solved or has no solution.
+     */
+    using Done = std::function<void(uint64_t search, GameLogic::Move move)>;
+
+    /**
+     * @brief Starts the worker thread, which waits for the first search.
+     * @param progress Function receiving progress, may be empty.
+     * @param done Function receiving results.
+     */
+    HintSearch(Progress progress, Done done);
+
+    /**
+     * @brief Cancels the running search and joins the worker thread.
+     */
+    ~HintSearch();
+
+    HintSearch(const HintSearch &) = delete;
+    HintSearch &operator=(const HintSearch &) = delete;
+
+    /**
+     * @brief Search for the best next move of a board, cancelling the previous search. Returns immediately.
+     * @param snapshot Board to hint, see GameLogic::snapshotBoard().
+     * @return Id of the search, passed to the callbacks. Ids start at 1 and grow.
+     */
+    uint64_t start(GameLogic::BoardSnapshot snapshot);
+
+    /**
+     * @brief Cancel the running or waiting search. Returns immediately, the solver stops at its next progress step.
+     */
+    void cancel();
+
+    /**
+     * @brief Check if the result of a search is still wanted, i.e. it is the last one started and cancel() was not
+     * called since. Thread-safe.
+     * @param search Id of the search returned by start().
+     * @return True if the result of the search should be shown.
+     */
+    bool isCurrent(uint64_t search) const;
+
+    /**
+     * @brief Check if a search is running or waiting for the worker.
+     * @return True if the worker is busy.
+     */
+    bool isBusy() const;
+
+private:
+    /**
+     * @brief Run searches until the object is destroyed.
+     */
+    void work();
+
+    /**
+     * @brief Search waiting for the worker.
+     */
+    struct Job
+    {
+        uint64_t id;
+        GameLogic::BoardSnapshot snapshot;
+    };
+
+    Progress progress;
+    Done done;
+    mutable std::mutex lock;
+    std::condition_variable wake;
+    std::unique_ptr<Job> pending;     // Next search, a newer one replaces it before it starts.
+    Solver::Monitor *running;         // Monitor of the running search, nullptr if idle.
+    uint64_t lastId;                  // Id of the last started search.
+    uint64_t current;                 // Id of the search whose result is wanted, 0 after cancel().
+    bool stopping;                    // Set by the destructor.
+    std::thread worker;
+};
+
+#endif // HINTSEARCH_HPP
@@ -0,0 +1,113 @@
+/**
+ * @file lazyboard.hpp
+ * @brief Header file for the LazyBoard class.
+ *
+ * This file contains the declaration of the LazyBoard class, a board whose
+ * moves cost the same on every size. Moves commute, so a cell is its start
+ * value plus the presses of its row and of its column, minus the presses of
+ * the cell itself, which were counted in both. LazyBoard keeps those press
+ * counts modulo 9 instead of the values: a move changes one row count, one
+ * column count and one cell, and a value is computed when it is read.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <cstddef>
+#include <vector>
+
+#ifndef LAZYBOARD_HPP
+#define LAZYBOARD_HPP
+
+/**
+ * @brief Board of size x size cells stored as press counts.
+ *
+ * The start value and the presses of a cell itself only ever appear
+ * together, so they are kept in one byte per cell: value - 1 minus the
+ * presses of the cell, modulo 9.
+ */
+class LazyBoard
+{
+public:
+    /**
+     * @brief Constructs an empty board of size 0.
+     */
+    LazyBoard();
+
+    /**
+     * @brief Resize the board and set all values to 9.
+     * @param size Number of rows and columns.
+     */
+    void reset(int size);
+
+    /**
+     * @brief Resize the board and copy values from a row-major array.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param size Number of rows and columns.
+     */
+    void assign(const int *values, int size);
+
+    /**
+     * @brief Copy all values into a row-major array.
+     * @param values Row-major array of size*size values to fill.
+     */
+    void copyTo(int *values) const;
+
+    /**
+     * @brief Increment all values in given row and column by one. If value was 9, sets it to 1.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     */
+    void increment(int row, int col)
+    {
+        rows[row] = rows[row] == 8 ? 0 : rows[row] + 1;
+        cols[col] = cols[col] == 8 ? 0 : cols[col] + 1;
+        unsigned char &cell = cells[static_cast<std::size_t>(row) * size + col];
+        cell = cell == 0 ? 8 : cell - 1; // The crossing cell is pressed once, not twice.
+    }
+
+    /**
+     * @brief Decrement all values in given row and column by one. If value was 1, sets it to 9.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     */
+    void decrement(int row, int col)
+    {
+        rows[row] = rows[row] == 0 ? 8 : rows[row] - 1;
+        cols[col] = cols[col] == 0 ? 8 : cols[col] - 1;
+        unsigned char &cell = cells[static_cast<std::size_t>(row) * size + col];
+        cell = cell == 8 ? 0 : cell + 1;
+    }
+
+    /**
+     * @brief Get value of a cell.
+     * @param row Row of the cell.
+     * @param col Column of the cell.
+     * @return Value in range [1, 9].
+     */
+    int value(int row, int col) const
+    {
+        return (cells[static_cast<std::size_t>(row) * size + col] + rows[row] + cols[col]) % 9 + 1;
+    }
+
+    /**
+     * @brief Check if all values of the board are 9. Reads every cell.
+     * @return True if the board is won.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief Get memory used by the cells and press counts.
+     * @return Number of bytes of lazy storage.
+     */
+    std::size_t bytes() const;
+
+private:
+    int size;                          // Number of rows and columns.
+    std::vector<unsigned char> cells;  // Row-major start value - 1 minus presses of the cell, modulo 9.
+    std::vector<unsigned char> rows;   // Presses of every row modulo 9.
+    std::vector<unsigned char> cols;   // Presses of every column modulo 9.
+};
+
+#endif // LAZYBOARD_HPP
@@ -12,8 +12,9 @@
  */
 
 #include "gamelogic.hpp"
+#include "hintsearch.hpp"
 #include <QMainWindow>
-#include <QPushButton>
+#include <memory>
 
 #ifndef MAINWINDOW_HPP
 #define MAINWINDOW_HPP
@@ -23,6 +24,7 @@ namespace Ui
 {
     class MainWindow;
 }
+class QProgressBar;
 QT_END_NAMESPACE
 
 /**
@@ -36,6 +38,8 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
+    static constexpr int MAX_SESSION_LOGS = 100; // Move logs kept in the sessions directory, older ones are deleted.
+
     /**
      * @brief Constructs a MainWindow object.
      *
@@ -48,6 +52,14 @@ public:
      */
     ~MainWindow();
 
+protected:
+    /**
+     * @brief Saves the game, so the next start resumes it.
+     *
+     * @param event The close event.
+     */
+    void closeEvent(QCloseEvent *event) override;
+
 private slots:
 
     /**
@@ -59,18 +71,10 @@ private slots:
 
     /**
      * @brief Play the cell using GameLogic class.
+     *
+     * @param move Cell clicked on the board.
      */
-    void playCell();
-
-    /**
-     * @brief Highlights squares in same column and row by adding red border.
-     */
-    void hoverEffect();
-
-    /**
-     * @brief Deletes the red border set by hoverEffect().
-     */
-    void unHoverEffect();
+    void playCell(GameLogic::Move move);
 
     /**
      * @brief Update difficulty according to slider position. Show popup warning the user that progress will be removed.
@@ -93,10 +97,28 @@ private slots:
     void colorsToggle();
 
     /**
-     * @brief Determine and highlight a cell containing the best move.
+     * @brief Start searching for the best move on a worker thread. The cell is highlighted when the result arrives,
+     * a move in the meantime cancels the search.
      */
     void hintAction();
 
+    /**
+     * @brief Jump to the position in move history selected with the history slider.
+     *
+     * @param moveIndex Number of moves from the start of the game.
+     */
+    void seekHistory(int moveIndex);
+
+    /**
+     * @brief Ask for a seed and start a new game with the board of that seed.
+     */
+    void newGameFromSeed();
+
+    /**
+     * @brief Ask for a board size and start a new game on a board of that size.
+     */
+    void changeBoardSize();
+
 private:
     /**
      * @brief Shows a win pop-up message when player wins.
@@ -104,68 +126,95 @@ private:
     int showPopup(int level);
 
     /**
-     * @brief Updates all cells in grid layout.
+     * @brief Updates all cells of the board and the game state around it.
      */
     void updateCells();
 
     /**
-     * @brief Highlights a button based on a game move.
+     * @brief Updates the cells in the row and column of a move and the game state around them.
      *
-     * This function takes a move from the game logic and highlights the corresponding button.
-     *
-     * @param move The move to be highlighted.
+     * @param move Move that was made.
      */
-    void highlightButton(const GameLogic::Move &move);
+    void updateCells(const GameLogic::Move &move);
 
     /**
-     * @brief Highlights a specific QPushButton.
-     *
-     * This function highlights the provided QPushButton.
-     *
-     * @param button Pointer to the QPushButton to be highlighted.
+     * @brief Updates the move counter, the actions and the history slider, and drops the hint of the previous board.
      */
-    void highlightButton(QPushButton *button);
+    void updateStatus();
 
     /**
-     * @brief Helper function which returns QColor for given value of a text.
-     * @param value Value of a text of QWidget.
-     * @return QColor rgb color in pastel colors.
+     * @brief Called after every new game: shows the seed of the board in the status bar, so the board can be shared,
+     * and records the session to a move log in the application data directory. Only the newest MAX_SESSION_LOGS logs
+     * are kept.
+     * @param keepHistory True to keep the undo/redo history in the new log, see GameLogic::startMoveLog().
      */
-    QColor getColorForValue(const QString &value);
+    void startSession(bool keepHistory = false);
 
     /**
-     * @brief Disable all buttons.
+     * @brief Called after the last session was restored from its snapshot: continues its move log, or starts a new
+     * one with the restored history if the log is gone or does not match the game.
      */
-    void disable_all();
+    void resumeSession();
 
     /**
-     * @brief Enable all buttons.
+     * @brief Get path of the directory of the move logs in the application data directory.
+     * @return Path of the directory.
      */
-    void enable_all();
+    QString sessionsPath() const;
 
     /**
-     * @brief Helper function to extract row and column from button name.
-     * @param button Button to extract name from.
-     * @return GameLogic::Move
+     * @brief Get path of the snapshot of the last session in the application data directory.
+     * @return Path of the snapshot file.
      */
-    GameLogic::Move getButtonRowCol(QPushButton *button) const;
+    QString snapshotPath() const;
 
     /**
-     * @brief Retrieves the QPushButton associated with a specific game move.
+     * @brief Updates range and position of the history slider without seeking.
+     */
+    void updateHistorySlider();
+
+    /**
+     * @brief Highlights the cell of a game move on the board.
      *
-     * This function takes a game move as input and returns the corresponding
-     * QPushButton that represents that move in the user interface.
-     * If no button is associated with the given move, the function may return
-     * a nullptr.
+     * @param move The move to be highlighted.
+     */
+    void highlightCell(const GameLogic::Move &move);
+
+    /**
+     * @brief Cancel the running hint search, if any, and hide its progress.
+     */
+    void cancelHint();
+
+    /**
+     * @brief Show the progress of a hint search. Called on the GUI thread.
      *
-     * @param move The game move for which to retrieve the associated button.
-     * @return A pointer to the QPushButton associated with the move, or nullptr
-     *         if no such button exists.
+     * @param search Id of the search, ignored if it is no longer current, see HintSearch::isCurrent().
+     * @param percent Percent done.
      */
-    QPushButton *getButtonByMove(const GameLogic::Move &move) const;
+    void showHintProgress(uint64_t search, int percent);
+
+    /**
+     * @brief Highlight the result of a hint search. Called on the GUI thread.
+     *
+     * @param search Id of the search, ignored if it is no longer current, see HintSearch::isCurrent().
+     * @param move Best next move, {-1, -1} if there is none.
+     */
+    void showHint(uint64_t search, GameLogic::Move move);
+
+    /**
+     * @brief Disable the board, e.g. after a win.
+     */
+    void disable_all();
+
+    /**
+     * @brief Enable the board.
+     */
+    void enable_all();
 
     Ui::MainWindow *ui;
     GameLogic game;
     bool show_colors;
+    std::unique_ptr<HintSearch> hintSearch; // Worker thread of hint searches.
+    QProgressBar *hintProgress;             // Progress of the hint search in the status bar.
 };
 #endif // MAINWINDOW_HPP
@@ -0,0 +1,118 @@
+/**
+ * @file mappedfile.hpp
+ * @brief Header file for the MappedFile class.
+ *
+ * This file contains the declaration of the MappedFile class, a small
+ * wrapper around memory-mapped files (mmap on POSIX systems, file mappings
+ * on Windows). Mapped files let large precomputed data be used directly
+ * from the page cache without reading or parsing it first.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+
+#include <cstddef>
+#include <string>
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+/**
+ * @brief A file mapped into memory. The mapping is released when the object is destroyed.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Constructs an object with no file mapped.
+     */
+    MappedFile();
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Map an existing file read-only. Pages are loaded on first access.
+     * @param path Path of the file.
+     * @return True if the file was mapped, false if it does not exist or cannot be mapped.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Create (or truncate) a file of given size and map it for writing.
+     * @param path Path of the file.
+     * @param size Size of the file in bytes.
+     * @return True if the file was created and mapped.
+     */
+    bool create(const std::string &path, std::size_t size);
+
+    /**
+     * @brief Unmap the file. Changes to a file mapped for writing are written back.
+     */
+    void close();
+
+    /**
+     * @brief Write changes of a file mapped for writing to the disk and wait for it (msync or FlushViewOfFile).
+     * @return True if the changes reached the disk.
+     */
+    bool flush();
+
+    /**
+     * @brief Rename a written file over another one, then sync the directory so the rename survives a crash.
+     * Readers see either the old or the new file, never none.
+     * @param from Path of the written file, flushed with flush() before.
+     * @param to Path of the file to replace.
+     * @return True if the file was renamed.
+     */
+    static bool replace(const std::string &from, const std::string &to);
+
+    /**
+     * @brief Tell the system that pages will be accessed in random order, so no read-ahead is done.
+     */
+    void adviseRandom();
+
+    /**
+     * @brief Tell the system that pages will be read in order, so read-ahead can be aggressive.
+     */
+    void adviseSequential();
+
+    /**
+     * @brief Check if a file is mapped.
+     * @return True if a file is mapped.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get mapped bytes.
+     * @return Pointer to the first byte of the file, nullptr if no file is mapped.
+     */
+    const unsigned char *data() const;
+
+    /**
+     * @brief Get mapped bytes of a file mapped for writing.
+     * @return Pointer to the first byte of the file, nullptr if no file is mapped.
+     */
+    unsigned char *data();
+
+    /**
+     * @brief Get size of the mapped file.
+     * @return Size in bytes.
+     */
+    std::size_t size() const;
+
+private:
+    unsigned char *bytes;
+    std::size_t length;
+#ifdef _WIN32
+    void *fileHandle;
+    void *mappingHandle;
+#endif
+};
+
+#endif // MAPPEDFILE_HPP
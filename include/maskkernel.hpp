@@ -0,0 +1,132 @@
+/**
+ * @file maskkernel.hpp
+ * @brief Vector kernel adding a mask of presses to cells stored one per byte.
+ *
+ * addMask() adds a press count in range [0, 8] to MASK_VECTOR_BYTES cells
+ * at once, wrapping values above 9 back to [1, 9]: a count of 1 is a move,
+ * a count of 8 undoes one. It uses AVX2 or SSE2, whichever the compiler
+ * targets, and a plain byte loop otherwise, see TARGET9_NATIVE in
+ * CMakeLists.txt. Used by BatchEnvironment and TiledBoard.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MASKKERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MASKKERNEL_SSE2
+#endif
+
+#ifndef MASKKERNEL_HPP
+#define MASKKERNEL_HPP
+
+/**
+ * @brief Count set bits of a lane mask.
+ * @param bits Mask.
+ * @return Number of set bits.
+ */
+inline int countMaskBits(uint32_t bits)
+{
+#if defined(__GNUC__)
+    return __builtin_popcount(bits);
+#else
+    int count = 0;
+    for (; bits != 0; bits &= bits - 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+#if defined(MASKKERNEL_AVX2)
+constexpr std::size_t MASK_VECTOR_BYTES = 32; // Cells handled by one addMask().
+
+/**
+ * @brief Add a mask to the cells of one vector.
+ * @param cells MASK_VECTOR_BYTES values in range [1, 9], need not be aligned.
+ * @param mask MASK_VECTOR_BYTES press counts in range [0, 8].
+ * @return Change of the number of cells not equal to 9.
+ */
+inline int addMask(unsigned char *cells, const unsigned char *mask)
+{
+    const __m256i nine = _mm256_set1_epi8(9);
+    __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cells));
+    __m256i add = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask));
+    __m256i untouched = _mm256_cmpeq_epi8(add, _mm256_setzero_si256());
+    __m256i left = _mm256_andnot_si256(untouched, _mm256_cmpeq_epi8(value, nine));
+    value = _mm256_add_epi8(value, add);
+    value = _mm256_sub_epi8(value, _mm256_and_si256(_mm256_cmpgt_epi8(value, nine), nine)); // 10 to 17 wrap to 1 to 8.
+    __m256i reached = _mm256_andnot_si256(untouched, _mm256_cmpeq_epi8(value, nine));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(cells), value);
+    return countMaskBits(static_cast<uint32_t>(_mm256_movemask_epi8(left))) -
+           countMaskBits(static_cast<uint32_t>(_mm256_movemask_epi8(reached)));
+}
+
+inline const char *maskKernelName()
+{
+    return "avx2";
+}
+#elif defined(MASKKERNEL_SSE2)
+constexpr std::size_t MASK_VECTOR_BYTES = 16; // Cells handled by one addMask().
+
+/**
+ * @brief Add a mask to the cells of one vector.
+ * @param cells MASK_VECTOR_BYTES values in range [1, 9], need not be aligned.
+ * @param mask MASK_VECTOR_BYTES press counts in range [0, 8].
+ * @return Change of the number of cells not equal to 9.
+ */
+inline int addMask(unsigned char *cells, const unsigned char *mask)
+{
+    const __m128i nine = _mm_set1_epi8(9);
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cells));
+    __m128i add = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+    __m128i untouched = _mm_cmpeq_epi8(add, _mm_setzero_si128());
+    __m128i left = _mm_andnot_si128(untouched, _mm_cmpeq_epi8(value, nine));
+    value = _mm_add_epi8(value, add);
+    value = _mm_sub_epi8(value, _mm_and_si128(_mm_cmpgt_epi8(value, nine), nine)); // 10 to 17 wrap to 1 to 8.
+    __m128i reached = _mm_andnot_si128(untouched, _mm_cmpeq_epi8(value, nine));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(cells), value);
+    return countMaskBits(static_cast<uint32_t>(_mm_movemask_epi8(left))) -
+           countMaskBits(static_cast<uint32_t>(_mm_movemask_epi8(reached)));
+}
+
+inline const char *maskKernelName()
+{
+    return "sse2";
+}
+#else
+constexpr std::size_t MASK_VECTOR_BYTES = 1; // Cells handled by one addMask().
+
+/**
+ * @brief Add a mask to one cell.
+ * @param cells Value in range [1, 9].
+ * @param mask Press count in range [0, 8].
+ * @return Change of the number of cells not equal to 9.
+ */
+inline int addMask(unsigned char *cells, const unsigned char *mask)
+{
+    if (*mask == 0)
+    {
+        return 0;
+    }
+    int change = *cells == 9;
+    int value = *cells + *mask;
+    *cells = static_cast<unsigned char>(value > 9 ? value - 9 : value);
+    return change - (*cells == 9);
+}
+
+inline const char *maskKernelName()
+{
+    return "scalar";
+}
+#endif
+
+#endif // MASKKERNEL_HPP
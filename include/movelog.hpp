@@ -0,0 +1,226 @@
+/**
+ * @file movelog.hpp
+ * @brief Header file for the MoveLogWriter and MoveLogReader classes.
+ *
+ * A move log stores one game session in a compact binary file: a header
+ * with the board size, the seed and the initial board, followed by every
+ * move, undo, redo and seek packed into as few bits as the board size needs
+ * (4 bits per event on a 3x3 board). The writer streams events to disk as
+ * they happen, the reader maps the file and replays it without parsing it
+ * into memory first.
+ *
+ * File layout, little-endian:
+ *  - uint32 magic, uint32 version, uint32 size, uint32 bits per event;
+ *  - uint64 seed, uint64 number of event slots;
+ *  - size*size bytes of the initial board;
+ *  - event slots, each one bitsPerEvent wide, starting at the lowest bit of the first byte.
+ * An event code below size*size is a move on that cell in row-major order,
+ * size*size is an undo and size*size + 1 is a redo. size*size + 2 is a seek,
+ * its target move index follows in the next seekSlots slots, lowest bits first.
+ * Version 1 logs have no seeks and are still read.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "mappedfile.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifndef MOVELOG_HPP
+#define MOVELOG_HPP
+
+class GameLogic;
+
+/**
+ * @brief Constants of the move log format shared by the writer and the reader.
+ */
+struct MoveLogFormat
+{
+    static constexpr uint32_t MAGIC = 0x4C4D3954; // "T9ML"
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint32_t MIN_VERSION = 1; // Oldest version that is still read.
+    static constexpr std::size_t HEADER_BYTES = 32;  // Fixed part of the header, the initial board follows.
+    static constexpr std::size_t EVENTS_OFFSET = 24; // Offset of the number of events in the header.
+
+    /**
+     * @brief Get number of bits of one event for a board size.
+     * @param size Number of rows and columns of the board.
+     * @return Bits needed for size*size + 3 event codes.
+     */
+    static int bitsPerEvent(int size);
+
+    /**
+     * @brief Get number of slots holding the target of a seek, after the seek code.
+     * @param size Number of rows and columns of the board.
+     * @return Slots of bitsPerEvent bits needed for a 32-bit move index.
+     */
+    static int seekSlots(int size);
+};
+
+/**
+ * @brief Streams the events of one game to a move log file.
+ */
+class MoveLogWriter
+{
+public:
+    /**
+     * @brief Constructs a writer with no file open.
+     */
+    MoveLogWriter();
+
+    /**
+     * @brief Writes the remaining events and closes the file.
+     */
+    ~MoveLogWriter();
+
+    MoveLogWriter(const MoveLogWriter &) = delete;
+    MoveLogWriter &operator=(const MoveLogWriter &) = delete;
+
+    /**
+     * @brief Create (or truncate) a log file and write its header.
+     * @param path Path of the file.
+     * @param size Number of rows and columns of the board.
+     * @param seed Seed of the board, see GameLogic::getSeed().
+     * @param board Row-major initial board of size*size values in range [1, 9].
+     * @return True if the file was created.
+     */
+    bool open(const std::string &path, int size, uint64_t seed, const int *board);
+
+    /**
+     * @brief Open an existing log file to record more events after the ones it has.
+     * @param path Path of the file.
+     * @return True if the file is a valid move log and was opened.
+     */
+    bool append(const std::string &path);
+
+    /**
+     * @brief Append a move.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     */
+    void recordMove(int row, int col);
+
+    /**
+     * @brief Append an undo of the last move.
+     */
+    void recordUndo();
+
+    /**
+     * @brief Append a redo of the last undone move.
+     */
+    void recordRedo();
+
+    /**
+     * @brief Append a jump to any position in the history, see GameLogic::seekTo(). Takes 1 + seekSlots() slots.
+     * @param moveIndex Number of moves from the start of the history.
+     */
+    void recordSeek(int moveIndex);
+
+    /**
+     * @brief Write all events to the file, so it can be read as it is now. Later events are appended after them.
+     */
+    void flush();
+
+    /**
+     * @brief Write all events and close the file.
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is open.
+     * @return True if events are being written.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get number of event slots in the file, including those it had when it was opened with append().
+     * @return Number of slots, a seek uses 1 + MoveLogFormat::seekSlots().
+     */
+    uint64_t getEventCount() const;
+
+private:
+    /**
+     * @brief Append an event code.
+     * @param code Event code of bitsPerEvent bits.
+     */
+    void record(uint32_t code);
+
+    std::FILE *file;
+    int size;
+    int bits;                          // Bits per event.
+    uint64_t events;                   // Events recorded.
+    uint64_t pending;                  // Bits of events not yet in buffer, lowest first.
+    int pendingBits;                   // Number of bits in pending, less than 8 after every event.
+    std::vector<unsigned char> buffer; // Complete bytes not yet written.
+};
+
+/**
+ * @brief Reads a memory-mapped move log.
+ */
+class MoveLogReader
+{
+public:
+    /**
+     * @brief Map a log file and check its header.
+     * @param path Path of the file.
+     * @throw std::runtime_error if the file cannot be opened or is not a valid move log.
+     */
+    explicit MoveLogReader(const std::string &path);
+
+    /**
+     * @brief Get number of rows and columns of the board.
+     * @return Size of the board.
+     */
+    int getSize() const;
+
+    /**
+     * @brief Get seed of the initial board.
+     * @return Seed.
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Get number of event slots in the log.
+     * @return Number of moves, undos and redos, plus 1 + MoveLogFormat::seekSlots() per seek.
+     */
+    uint64_t getEventCount() const;
+
+    /**
+     * @brief Get the initial board.
+     * @return Row-major vector of size*size values in range [1, 9].
+     */
+    std::vector<int> getInitialBoard() const;
+
+    /**
+     * @brief Replay the whole session through a game: the game starts from the initial board and plays every event.
+     * Runs of moves are played with GameLogic::makeMoves(), runs of undos with GameLogic::undoMoves() and seeks with GameLogic::seekTo().
+     * @param game Game to replay into, its size, board and history are replaced.
+     * @throw std::runtime_error if the log undoes, redoes or seeks to moves that do not exist.
+     */
+    void replay(GameLogic &game) const;
+
+    /**
+     * @brief Check that the log ends on a won board without replaying it move by move.
+     * Undos, redos and seeks only move a cursor in the list of moves, then all moves before the cursor are applied at once
+     * from their row, column and cell press counts in O(size*size + events).
+     * @param moves If not nullptr, receives the number of moves of the solution, i.e. moves before the cursor.
+     * @return True if the final board is won.
+     * @throw std::runtime_error if the log undoes, redoes or seeks to moves that do not exist.
+     */
+    bool verifySolution(int *moves = nullptr) const;
+
+private:
+    MappedFile file;
+    int size;
+    int bits;
+    uint64_t seed;
+    uint64_t events;
+    const unsigned char *eventData; // First byte of the events.
+};
+
+#endif // MOVELOG_HPP
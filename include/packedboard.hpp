@@ -0,0 +1,107 @@
+/**
+ * @file packedboard.hpp
+ * @brief Header file for the PackedBoard class.
+ *
+ * This file contains the declaration of the PackedBoard class, which stores
+ * a target 9 board with 4 bits per cell, 16 cells per 64-bit word. Moves are
+ * applied with SIMD-within-a-register arithmetic: a whole word of a row is
+ * incremented with a single add, and the 9 -> 1 wraparound is done with a
+ * branch-free mask instead of a per-cell modulo.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+
+#include <cstdint>
+#include <vector>
+
+#ifndef PACKEDBOARD_HPP
+#define PACKEDBOARD_HPP
+
+/**
+ * @brief Board of size x size cells packed into 4-bit nibbles.
+ *
+ * Every row starts on a new word, unused nibbles at the end of a row hold 9
+ * so that a won board is exactly a sequence of all-9s words.
+ */
+class PackedBoard
+{
+public:
+    /**
+     * @brief Constructs an empty board of size 0.
+     */
+    PackedBoard();
+
+    /**
+     * @brief Resize the board and set all values to 9.
+     * @param size Number of rows and columns.
+     */
+    void reset(int size);
+
+    /**
+     * @brief Resize the board and copy values from a row-major array.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param size Number of rows and columns.
+     */
+    void assign(const int *values, int size);
+
+    /**
+     * @brief Copy all values into a row-major array.
+     * @param values Row-major array of size*size values to fill.
+     */
+    void copyTo(int *values) const;
+
+    /**
+     * @brief Increment all values in given row and column by one. If value was 9, sets it to 1.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int increment(int row, int col);
+
+    /**
+     * @brief Decrement all values in given row and column by one. If value was 1, sets it to 9.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int decrement(int row, int col);
+
+    /**
+     * @brief Get value of a cell.
+     * @param row Row of the cell.
+     * @param col Column of the cell.
+     * @return Value in range [1, 9].
+     */
+    int value(int row, int col) const
+    {
+        return static_cast<int>((words[row * stride + (col >> 4)] >> ((col & 15) * 4)) & 0xF);
+    }
+
+    /**
+     * @brief Check if all values of the board are 9 by comparing whole words.
+     * @return True if the board is won.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief Get memory used by the cells.
+     * @return Number of bytes of packed storage.
+     */
+    std::size_t bytes() const;
+
+private:
+    int size;                    // Number of rows and columns.
+    int stride;                  // Number of words per row.
+    std::vector<uint64_t> words; // Row-major packed cells, 16 per word.
+
+    /**
+     * @brief Get mask with the lowest bit of every nibble that holds a cell of given row word.
+     * @param word Index of the word inside the row.
+     * @return Mask of 0x1 nibbles for used cells.
+     */
+    uint64_t rowMask(int word) const;
+};
+
+#endif // PACKEDBOARD_HPP
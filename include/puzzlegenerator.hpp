@@ -0,0 +1,112 @@
+/**
+ * @file puzzlegenerator.hpp
+ * @brief Header file for the PuzzleGenerator class.
+ *
+ * This file contains the declaration of the PuzzleGenerator class, which
+ * generates packs of unique puzzles offline on all cores. Every worker
+ * thread has its own random stream derived from one seed, puzzles are
+ * deduplicated by their board state and labeled with the optimal number
+ * of moves computed by the Solver. The generator does not depend on Qt.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#ifndef PUZZLEGENERATOR_HPP
+#define PUZZLEGENERATOR_HPP
+
+/**
+ * @brief Generates unique labeled puzzles in parallel.
+ */
+class PuzzleGenerator
+{
+public:
+    /**
+     * @brief Settings of a generator run.
+     */
+    struct Options
+    {
+        int size = 3;              // Number of rows and columns of the boards.
+        int presses = -1;          // Random presses used to scramble a won board, -1 for a random press count in [0, 8] per cell.
+        int distance = -1;         // Requested optimal number of moves, -1 for any.
+        uint64_t count = 1000;     // Number of unique puzzles to generate.
+        int threads = 1;           // Number of worker threads.
+        uint64_t seed = 0;         // Seed of all random streams, the same seed gives the same puzzles with one thread.
+        uint64_t maxAttempts = 0;  // Boards to try before giving up, 0 for 10 * count + 1000000.
+        bool symmetric = false;    // Also drop boards equal to an earlier one up to row and column order and transposition.
+    };
+
+    /**
+     * @brief Receives generated puzzles. Called under a lock, so calls never overlap.
+     * @param cells Row-major array of size*size cell values in range [1, 9].
+     * @param distance Optimal number of moves to win the puzzle.
+     */
+    using Sink = std::function<void(const unsigned char *cells, int distance)>;
+
+    /**
+     * @brief Constructs a generator.
+     * @param options Settings of the run.
+     * @throw std::invalid_argument if size, threads or distance are out of range, or size is too large for symmetric.
+     */
+    explicit PuzzleGenerator(const Options &options);
+
+    /**
+     * @brief Generate puzzles and pass them to the sink as they are found.
+     * @param sink Function receiving every unique puzzle.
+     * @return Number of puzzles passed to the sink. Less than requested only if maxAttempts was reached.
+     */
+    uint64_t run(const Sink &sink);
+
+    /**
+     * @brief Get number of boards generated in the last run, including duplicates and rejected boards.
+     * @return Number of boards.
+     */
+    uint64_t getAttempts() const;
+
+    /**
+     * @brief Get number of boards dropped in the last run because they were generated before.
+     * @return Number of boards.
+     */
+    uint64_t getDuplicates() const;
+
+    /**
+     * @brief Check if distance labels are exact for the board size, see Solver::isExact().
+     * @return True if labels are exact, false if they are upper bounds.
+     */
+    bool isExact() const;
+
+private:
+    /**
+     * @brief Generate puzzles on one thread until enough were found by all threads.
+     * @param stream Index of the random stream of the thread.
+     * @param sink Function receiving every unique puzzle.
+     */
+    void work(int stream, const Sink &sink);
+
+    /**
+     * @brief Part of the set of generated boards, each part has its own lock so threads rarely wait.
+     */
+    struct Shard
+    {
+        std::mutex lock;
+        std::unordered_set<std::string> boards; // Boards packed two cells per byte.
+    };
+
+    Options options;
+    std::vector<Shard> shards;
+    std::mutex sinkLock;
+    std::atomic<uint64_t> found;      // Unique puzzles passed to the sink.
+    std::atomic<uint64_t> attempts;   // Boards generated.
+    std::atomic<uint64_t> duplicates; // Boards dropped as duplicates.
+};
+
+#endif // PUZZLEGENERATOR_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file serverprotocol.hpp
+ * @brief Header file for the ServerProtocol class.
+ *
+ * This file contains the declaration of the ServerProtocol class, which
+ * converts GameServer requests and responses to and from the two wire
+ * formats of target9-server:
+ *  - JSON lines: one flat JSON object per line, e.g.
+ *    {"cmd":"move","tag":7,"session":3,"row":1,"col":2} answered by
+ *    {"tag":7,"cmd":"move","ok":true,"session":3,"moves":5,"won":false}.
+ *    New and State responses add "size", "seed" and "board", the cell
+ *    values as one string of digits in row-major order. Hint responses add
+ *    "row" and "col", failed requests have "ok":false and "error".
+ *  - Binary: requests of REQUEST_BYTES bytes and responses of
+ *    RESPONSE_HEADER_BYTES bytes followed by the board or the error text,
+ *    all numbers little-endian. See serverprotocol.cpp for the layout.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "gameserver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifndef SERVERPROTOCOL_HPP
+#define SERVERPROTOCOL_HPP
+
+/**
+ * @brief Encodes and decodes the JSON lines and binary formats of the game server.
+ */
+class ServerProtocol
+{
+public:
+    static constexpr std::size_t REQUEST_BYTES = 32;         // Size of a binary request.
+    static constexpr std::size_t RESPONSE_HEADER_BYTES = 44; // Size of a binary response without its board or error text.
+
+    /**
+     * @brief Get name of a command used by the JSON format.
+     * @param command Command.
+     * @return Name, e.g. "move". "unknown" for values that are not commands.
+     */
+    static const char *commandName(GameServer::Command command);
+
+    /**
+     * @brief Parse a JSON request line.
+     * @param line Line without the line break.
+     * @param request Parsed request. Its tag is set as soon as it is read, so errors can be tagged too.
+     * @param error Reason if the line is not a valid request.
+     * @return True if the line is a valid request.
+     */
+    static bool parseRequest(const std::string &line, GameServer::Request &request, std::string &error);
+
+    /**
+     * @brief Format a request as a JSON line, used by clients.
+     * @param request Request to format.
+     * @return Line ending with a line break.
+     */
+    static std::string formatRequest(const GameServer::Request &request);
+
+    /**
+     * @brief Format a response as a JSON line.
+     * @param response Response to format.
+     * @return Line ending with a line break.
+     */
+    static std::string formatResponse(const GameServer::Response &response);
+
+    /**
+     * @brief Format the answer to a line that is not a valid request.
+     * @param tag Tag of the request, 0 if it could not be read.
+     * @param error Reason of the failure.
+     * @return Line ending with a line break.
+     */
+    static std::string formatError(uint32_t tag, const std::string &error);
+
+    /**
+     * @brief Parse a JSON response line, used by clients.
+     * @param line Line without the line break.
+     * @param response Parsed response.
+     * @param error Reason if the line is not a valid response.
+     * @return True if the line is a valid response.
+     */
+    static bool parseResponse(const std::string &line, GameServer::Response &response, std::string &error);
+
+    /**
+     * @brief Decode a binary request.
+     * @param bytes REQUEST_BYTES bytes.
+     * @param request Decoded request. Its command and tag are set even if the command is unknown.
+     * @param error Reason if the bytes are not a valid request.
+     * @return True if the request is valid.
+     */
+    static bool decodeRequest(const unsigned char *bytes, GameServer::Request &request, std::string &error);
+
+    /**
+     * @brief Encode a binary request, used by clients.
+     * @param request Request to encode.
+     * @param bytes Output of REQUEST_BYTES bytes.
+     */
+    static void encodeRequest(const GameServer::Request &request, unsigned char *bytes);
+
+    /**
+     * @brief Append a binary response to a buffer.
+     * @param response Response to encode.
+     * @param frame Buffer the response is appended to.
+     */
+    static void encodeResponse(const GameServer::Response &response, std::string &frame);
+
+    /**
+     * @brief Get the size of a binary response from its first four bytes.
+     * @param bytes Start of the response.
+     * @return Size of the whole response in bytes.
+     */
+    static std::size_t responseSize(const unsigned char *bytes);
+
+    /**
+     * @brief Decode a binary response, used by clients.
+     * @param bytes Whole response, see responseSize().
+     * @param size Number of bytes.
+     * @param response Decoded response.
+     * @return True if the response is complete and consistent.
+     */
+    static bool decodeResponse(const unsigned char *bytes, std::size_t size, GameServer::Response &response);
+};
+
+#endif // SERVERPROTOCOL_HPP
@@ -0,0 +1,95 @@
+/**
+ * @file solver.hpp
+ * @brief Header file for the Solver class.
+ *
+ * This file contains the declaration of the Solver class, which computes the
+ * exact minimum number of presses needed to turn a board into the winning
+ * board. Moves in target 9 commute and pressing the same cell nine times has
+ * no effect, so any solution is fully described by a press count modulo 9
+ * for every cell. The solver finds that press count vector directly by
+ * solving the linear system the moves form modulo 9.
+ *
+ * @author Ignat Romanov
+ * @version 1.1
+ * @date 16.10.2026
+ */
+
+#include <atomic>
+#include <functional>
+
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+/**
+ * @brief Computes optimal solutions for target 9 boards.
+ */
+class Solver
+{
+public:
+    static constexpr int CANCELLED = -2; // Returned by solve() when the monitor cancelled it.
+
+    /**
+     * @brief Lets another thread follow and stop a running solve.
+     */
+    struct Monitor
+    {
+        std::atomic<bool> cancelled{false};        // Set from any thread to stop the solve, which then returns CANCELLED.
+        std::function<void(int percent)> progress; // Called on the solving thread whenever the percent done grows, may be empty.
+        int percent = 0;                           // Last reported percent done.
+    };
+
+    /**
+     * @brief Compute the minimum-press solution for a board.
+     *
+     * A press at (r, c) adds one to every cell of row r and column c, so the
+     * value added to cell (a, b) is R[a] + C[b] - p[a][b], where R and C are
+     * the row and column press totals. Requiring that to equal the deficit of
+     * every cell gives a linear system modulo 9 in the row and column totals:
+     *  - size divisible by 3: the system has exactly one solution, found in O(N^2);
+     *  - size 3k + 2: up to nine solutions that differ by a constant press count, found in O(N^2);
+     *  - size 3k + 1: row and column totals are only fixed modulo 3 (or not at all),
+     *    the cheapest combination is searched exhaustively for small boards and
+     *    approximated by alternating row/column minimization otherwise, see isExact().
+     *
+     * @param board Row-major array of size*size cell values in range [1, 9].
+     * @param size Number of rows (and columns) of the board.
+     * @param presses Row-major output array of size*size press counts in range [0, 8].
+     * @param monitor Optional progress and cancellation of the solve.
+     * @return Number of moves left, i.e. sum of all press counts. -1 if the board cannot be solved, CANCELLED if it was cancelled.
+     * @throw std::invalid_argument if the size is not positive.
+     */
+    static int solve(const int *board, int size, int *presses, Monitor *monitor = nullptr);
+
+    /**
+     * @brief Compute the minimum-press solution for a board whose row and column deficit sums are already known.
+     *
+     * Skips the pass over the board that sums the deficits (9 - value modulo 9)
+     * of every row and column, for callers that keep these sums up to date.
+     * Only the sums modulo 9 matter.
+     *
+     * @param board Row-major array of size*size cell values in range [1, 9].
+     * @param size Number of rows (and columns) of the board.
+     * @param presses Row-major output array of size*size press counts in range [0, 8].
+     * @param rowDeficits Sum of deficits of every row modulo 9, size values.
+     * @param colDeficits Sum of deficits of every column modulo 9, size values.
+     * @param monitor Optional progress and cancellation of the solve.
+     * @return Number of moves left, i.e. sum of all press counts. -1 if the board cannot be solved, CANCELLED if it was cancelled.
+     * @throw std::invalid_argument if the size is not positive.
+     */
+    static int solve(const int *board, int size, int *presses, const int *rowDeficits, const int *colDeficits, Monitor *monitor = nullptr);
+
+    /**
+     * @brief Check if Solver::solve() returns the optimal solution for boards of given size.
+     * @param size Number of rows (and columns) of the board.
+     * @return True if the solution is guaranteed to be minimal, false if it is approximated.
+     */
+    static bool isExact(int size);
+
+private:
+    /**
+     * @brief Solve boards whose size is not divisible by 3, where the press totals are not unique.
+     */
+    static int solveAmbiguous(const int *board, int size, int *presses, const int *rowDeficits, const int *colDeficits, Monitor *monitor);
+};
+
+#endif // SOLVER_HPP
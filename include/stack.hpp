@@ -1,28 +1,41 @@
 /**
  * @file stack.h
- * @brief A template-based stack implementation using a linked list.
+ * @brief A template-based stack implementation using contiguous chunks.
  *
- * This file defines a generic stack class that uses a linked list
- * to store elements. The stack supports standard operations such as
- * push, pop, and top, and it can store any data type specified by
- * the user.
+ * This file defines a generic stack class that stores elements in
+ * fixed-size chunks of contiguous memory. A push only allocates when a
+ * chunk is full, so long sessions with millions of moves do not call the
+ * allocator for every element. The stack supports standard operations
+ * such as push, pop, and top, and it can store any data type specified
+ * by the user.
  *
  * @tparam T The type of elements stored in the stack. This can be
  *            any data type, including built-in types and user-defined
  *            types, e.g. Move.
  *
  * @author Ignat Romanov
- * @version 1.0
- * @date 20.11.2024
+ * @version 1.1
+ * @date 16.10.2026
  */
 
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #ifndef STACK_HPP
 #define STACK_HPP
 
 /**
- * @brief A template-based stack implementation using a linked list.
+ * @brief A template-based stack implementation using contiguous chunks.
+ *
+ * Memory is bounded: pops and truncate() release chunks as soon as more
+ * than one empty chunk is left above the top, except for the capacity
+ * requested with Stack::reserve(). clear() keeps every chunk for reuse.
  *
  * @tparam T The type of elements stored in the stack. This can be any data type, including built-in types and user-defined types.
  */
@@ -30,19 +43,41 @@ template <typename T>
 class Stack
 {
 public:
+    static constexpr std::size_t CHUNK_BYTES = 4096;                                                      // Target size of one chunk.
+    static constexpr std::size_t CHUNK_SIZE = sizeof(T) < CHUNK_BYTES ? CHUNK_BYTES / sizeof(T) : 1; // Elements per chunk.
+
     /**
-     * @brief Constructs an empty stack.
-     *
-     * Initializes the topNode pointer to nullptr, indicating that the
-     * stack is empty.
+     * @brief Constructs an empty stack. No memory is allocated until the first push.
      */
     Stack();
 
+    /**
+     * @brief Constructs a copy of another stack.
+     *
+     * @param other Stack to copy.
+     */
+    Stack(const Stack &other);
+
+    /**
+     * @brief Takes over the chunks of another stack, which is left empty.
+     *
+     * @param other Stack to move from.
+     */
+    Stack(Stack &&other) noexcept;
+
+    /**
+     * @brief Replaces the contents with a copy or the chunks of another stack.
+     *
+     * @param other Stack to assign.
+     * @return Reference to this stack.
+     */
+    Stack &operator=(Stack other) noexcept;
+
     /**
      * @brief Destroys the stack and frees allocated memory.
      *
-     * This destructor will deallocate all nodes in the stack to
-     * prevent memory leaks.
+     * This destructor will destroy all elements and deallocate all
+     * chunks to prevent memory leaks.
      */
     ~Stack();
 
@@ -54,11 +89,35 @@ public:
     bool isEmpty() const;
 
     /**
-     * @brief Pushes a new value onto the top of the stack.
+     * @brief Pushes a copy of a value onto the top of the stack.
+     *
+     * @param value The value to be added to the stack.
+     */
+    void push(const T &value);
+
+    /**
+     * @brief Moves a value onto the top of the stack.
      *
      * @param value The value to be added to the stack.
      */
-    void push(T value);
+    void push(T &&value);
+
+    /**
+     * @brief Constructs a value in place on the top of the stack.
+     *
+     * @param args Arguments passed to the constructor of T.
+     * @return Reference to the new value.
+     */
+    template <typename... Args>
+    T &emplace(Args &&...args);
+
+    /**
+     * @brief Pushes copies of an array of values, filling whole chunks at once.
+     *
+     * @param values Values to push, values[0] is pushed first.
+     * @param count Number of values.
+     */
+    void append(const T *values, std::size_t count);
 
     /**
      * @brief Removes and returns the value at the top of the stack.
@@ -76,53 +135,173 @@ public:
      */
     T top() const;
 
+    /**
+     * @brief Returns a value by its position from the bottom of the stack without removing it.
+     *
+     * @param index Position of the value, 0 is the first pushed value.
+     * @return Reference to the value.
+     * @throw std::out_of_range if index is not less than Stack::size().
+     */
+    const T &at(std::size_t index) const;
+
+    /**
+     * @brief Removes values from the top until at most given number is left.
+     *
+     * @param count Number of values to keep.
+     */
+    void truncate(std::size_t count);
+
+    /**
+     * @brief Removes all values. O(1) for trivially destructible types, all chunks are kept for the next values.
+     */
+    void clear();
+
+    /**
+     * @brief Allocates memory for at least given number of values. The capacity is kept after pops and clear().
+     *
+     * @param capacity Number of values to allocate memory for.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Returns the number of values in the stack.
+     *
+     * @return Number of values.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of values that fit in allocated chunks.
+     *
+     * @return Number of values.
+     */
+    std::size_t capacity() const;
+
 private:
     /**
-     * @brief A private structure representing a node in the linked list.
+     * @brief Returns the slot of a value in its chunk.
      *
-     * Each node contains a data element of type T and a pointer to the
-     * next node in the stack.
+     * @param index Position from the bottom of the stack.
+     * @return Pointer to the slot, which may not hold a value yet.
      */
-    struct Node
-    {
-        T data;
-        Node *next;
-
-        /**
-         * @brief Constructs a new node with the given value.
-         *
-         * @param value The value to be stored in the node.
-         */
-        Node(T value) : data(value), next(nullptr) {}
-    };
-
-    Node *topNode;
+    T *slot(std::size_t index) const;
+
+    /**
+     * @brief Returns a free slot for a new value on the top, allocating a chunk if all are full.
+     *
+     * @return Pointer to uninitialized memory.
+     */
+    T *pushSlot();
+
+    /**
+     * @brief Releases empty chunks so that at most one is left above the top, but not fewer than reserved.
+     */
+    void releaseChunks();
+
+    std::vector<T *> chunks; // Chunks of CHUNK_SIZE slots, values fill them from the first one.
+    std::size_t count;       // Number of values.
+    std::size_t reserved;    // Number of chunks that are never released.
 };
 
 template <typename T>
-Stack<T>::Stack() : topNode(nullptr) {} // Assign top node to nullptr (empty).
+Stack<T>::Stack() : count(0), reserved(0) {}
+
+template <typename T>
+Stack<T>::Stack(const Stack &other) : Stack()
+{
+    reserve(other.count);
+    reserved = 0; // The copy only keeps what it holds.
+    for (std::size_t i = 0; i < other.count; ++i)
+    {
+        push(*other.slot(i));
+    }
+}
+
+template <typename T>
+Stack<T>::Stack(Stack &&other) noexcept : chunks(std::move(other.chunks)), count(other.count), reserved(other.reserved)
+{
+    other.chunks.clear();
+    other.count = 0;
+    other.reserved = 0;
+}
+
+template <typename T>
+Stack<T> &Stack<T>::operator=(Stack other) noexcept
+{
+    chunks.swap(other.chunks);
+    std::swap(count, other.count);
+    std::swap(reserved, other.reserved);
+    return *this;
+}
 
 template <typename T>
 Stack<T>::~Stack()
 {
-    while (!isEmpty())
+    clear();
+    for (T *chunk : chunks)
     {
-        pop(); // Pop from the stack untill it's empty.
+        ::operator delete(chunk); // Free memory of every chunk.
     }
 }
 
 template <typename T>
 bool Stack<T>::isEmpty() const
 {
-    return topNode == nullptr; // Stack is empty when topNode==nullptr.
+    return count == 0; // Stack is empty when there are no values.
+}
+
+template <typename T>
+T *Stack<T>::slot(std::size_t index) const
+{
+    return chunks[index / CHUNK_SIZE] + index % CHUNK_SIZE;
+}
+
+template <typename T>
+T *Stack<T>::pushSlot()
+{
+    if (count == chunks.size() * CHUNK_SIZE) // All chunks are full.
+    {
+        chunks.push_back(static_cast<T *>(::operator new(CHUNK_SIZE * sizeof(T))));
+    }
+    return slot(count);
+}
+
+template <typename T>
+void Stack<T>::push(const T &value)
+{
+    new (pushSlot()) T(value); // Copy value into the next free slot.
+    ++count;
+}
+
+template <typename T>
+void Stack<T>::push(T &&value)
+{
+    new (pushSlot()) T(std::move(value));
+    ++count;
 }
 
 template <typename T>
-void Stack<T>::push(T value)
+template <typename... Args>
+T &Stack<T>::emplace(Args &&...args)
 {
-    Node *newNode = new Node(value); // Create new node.
-    newNode->next = topNode;         // Assign the next node after the newNode to be current topNode.
-    topNode = newNode;               // Update the topNode with newNode.
+    T *value = new (pushSlot()) T{std::forward<Args>(args)...};
+    ++count;
+    return *value;
+}
+
+template <typename T>
+void Stack<T>::append(const T *values, std::size_t count)
+{
+    while (count > 0)
+    {
+        T *first = pushSlot();
+        std::size_t room = CHUNK_SIZE - this->count % CHUNK_SIZE; // Free slots in the top chunk.
+        std::size_t part = count < room ? count : room;
+        std::uninitialized_copy(values, values + part, first);
+        this->count += part;
+        values += part;
+        count -= part;
+    }
 }
 
 template <typename T>
@@ -132,11 +311,15 @@ T Stack<T>::pop()
     {
         throw std::underflow_error("Stack underflow! Cannot pop from an empty stack.");
     }
-    Node *temp = topNode;        // Create temp node and point to current topNode.
-    T pop_value = topNode->data; // Get value from current topNode.
-    topNode = topNode->next;     // Update topNode to be the next node after the topNode.
-    delete temp;                 // Free memory by removeing old topNode.
-    return pop_value;            // Return value stored in old topNode.
+    T *topValue = slot(count - 1);
+    T pop_value = std::move(*topValue); // Get value from the top slot.
+    topValue->~T();
+    --count;
+    if (count % CHUNK_SIZE == 0)
+    {
+        releaseChunks(); // A chunk became empty.
+    }
+    return pop_value; // Return value stored in old top slot.
 }
 
 template <typename T>
@@ -146,7 +329,90 @@ T Stack<T>::top() const
     {
         throw std::underflow_error("Stack underflow! Cannot peek into an empty stack.");
     }
-    return topNode->data; // Return value stored.
+    return *slot(count - 1); // Return value stored.
+}
+
+template <typename T>
+const T &Stack<T>::at(std::size_t index) const
+{
+    if (index >= count)
+    {
+        throw std::out_of_range("Stack index " + std::to_string(index) + " is out of range.");
+    }
+    return *slot(index);
+}
+
+template <typename T>
+void Stack<T>::truncate(std::size_t count)
+{
+    if (count >= this->count)
+    {
+        return;
+    }
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = count; i < this->count; ++i)
+        {
+            slot(i)->~T();
+        }
+    }
+    this->count = count;
+    releaseChunks();
+}
+
+template <typename T>
+void Stack<T>::clear()
+{
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            slot(i)->~T();
+        }
+    }
+    count = 0; // Chunks are reused by the next pushes, the destructor frees them.
+}
+
+template <typename T>
+void Stack<T>::reserve(std::size_t capacity)
+{
+    std::size_t needed = (capacity + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunks.reserve(needed);
+    while (chunks.size() < needed)
+    {
+        chunks.push_back(static_cast<T *>(::operator new(CHUNK_SIZE * sizeof(T))));
+    }
+    if (needed > reserved)
+    {
+        reserved = needed;
+    }
+}
+
+template <typename T>
+void Stack<T>::releaseChunks()
+{
+    std::size_t keep = (count + CHUNK_SIZE - 1) / CHUNK_SIZE + 1; // Chunks in use and one spare, so push/pop at a chunk border does not allocate every time.
+    if (keep < reserved)
+    {
+        keep = reserved;
+    }
+    while (chunks.size() > keep)
+    {
+        ::operator delete(chunks.back());
+        chunks.pop_back();
+    }
+}
+
+template <typename T>
+std::size_t Stack<T>::size() const
+{
+    return count;
+}
+
+template <typename T>
+std::size_t Stack<T>::capacity() const
+{
+    return chunks.size() * CHUNK_SIZE;
 }
 
-#endif // STACK_HPP
\ No newline at end of file
+#endif // STACK_HPP
@@ -0,0 +1,135 @@
+/**
+ * @file tiledboard.hpp
+ * @brief Header file for the TiledBoard class.
+ *
+ * This file contains the declaration of the TiledBoard class, a board for
+ * large sizes whose column updates cost the same as its row updates. In a
+ * row-major board a column touches one cache line per cell. TiledBoard
+ * stores one byte per cell in tiles of 8x8 cells, each tile one 64-byte
+ * cache line, so a row and a column both touch size / 8 lines. Tiles are
+ * grouped in blocks of 8x8 tiles, 4 KiB each, so a row and a column also
+ * cross the same number of pages.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include <cstddef>
+#include <vector>
+
+#ifndef TILEDBOARD_HPP
+#define TILEDBOARD_HPP
+
+/**
+ * @brief Board of size x size cells stored in cache-line tiles.
+ *
+ * Cells outside the board in the last tiles and blocks hold 9 and are never
+ * changed, so a won board is exactly a sequence of all-9 tiles.
+ */
+class TiledBoard
+{
+public:
+    static constexpr int TILE_SIZE = 8;   // Rows and columns of a tile.
+    static constexpr int BLOCK_TILES = 8; // Rows and columns of tiles in a block.
+
+    /**
+     * @brief Constructs an empty board of size 0.
+     */
+    TiledBoard();
+
+    /**
+     * @brief Resize the board and set all values to 9.
+     * @param size Number of rows and columns.
+     */
+    void reset(int size);
+
+    /**
+     * @brief Resize the board and copy values from a row-major array.
+     * @param values Row-major array of size*size values in range [1, 9].
+     * @param size Number of rows and columns.
+     */
+    void assign(const int *values, int size);
+
+    /**
+     * @brief Copy all values into a row-major array.
+     * @param values Row-major array of size*size values to fill.
+     */
+    void copyTo(int *values) const;
+
+    /**
+     * @brief Increment all values in given row and column by one. If value was 9, sets it to 1.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int increment(int row, int col);
+
+    /**
+     * @brief Decrement all values in given row and column by one. If value was 1, sets it to 9.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int decrement(int row, int col);
+
+    /**
+     * @brief Get value of a cell.
+     * @param row Row of the cell.
+     * @param col Column of the cell.
+     * @return Value in range [1, 9].
+     */
+    int value(int row, int col) const
+    {
+        return tiles[tileIndex(row / TILE_SIZE, col / TILE_SIZE)].cells[row % TILE_SIZE * TILE_SIZE + col % TILE_SIZE];
+    }
+
+    /**
+     * @brief Check if all values of the board are 9.
+     * @return True if the board is won.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief Get memory used by the cells.
+     * @return Number of bytes of tiled storage.
+     */
+    std::size_t bytes() const;
+
+private:
+    /**
+     * @brief Cells of a tile in row-major order, aligned to a cache line.
+     */
+    struct alignas(64) Tile
+    {
+        unsigned char cells[TILE_SIZE * TILE_SIZE];
+    };
+
+    /**
+     * @brief Get index of a tile in tiles.
+     * @param tileRow Row of the tile.
+     * @param tileCol Column of the tile.
+     * @return Index of the tile.
+     */
+    std::size_t tileIndex(int tileRow, int tileCol) const
+    {
+        std::size_t block = static_cast<std::size_t>(tileRow / BLOCK_TILES) * blocks + tileCol / BLOCK_TILES;
+        return block * BLOCK_TILES * BLOCK_TILES + tileRow % BLOCK_TILES * BLOCK_TILES + tileCol % BLOCK_TILES;
+    }
+
+    /**
+     * @brief Add presses to the row and column of a move.
+     * @param row Row of the move.
+     * @param col Column of the move.
+     * @param presses 1 to increment, 8 to decrement.
+     * @return Change of the number of cells not equal to 9.
+     */
+    int press(int row, int col, unsigned char presses);
+
+    int size;                // Number of rows and columns.
+    int lineTiles;           // Number of tiles in a row or column of the board.
+    int blocks;              // Number of blocks in a row or column of tiles.
+    std::vector<Tile> tiles; // Tiles block by block, row-major inside a block.
+};
+
+#endif // TILEDBOARD_HPP
@@ -0,0 +1,202 @@
+/**
+ * @file batchenvironment.cpp
+ * @brief Implementation of BatchEnvironment class methods.
+ *
+ * A move adds 1 to every cell of its row and column, the crossing cell once.
+ * Small boards keep one mask per move with exactly those ones, so a step is
+ * one or a few vector additions. Values that reach 10 wrap to 1, and the
+ * masked lanes that were 9 before or are 9 after give the change of the
+ * unsolved count. The last vector of a board reaches into the next board
+ * or the padding, where the mask is 0 and values are stored unchanged.
+ * Boards are stepped in interleaved passes, so the load of a board never
+ * overlaps the store of the board stepped just before it, which would stall
+ * store forwarding.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "batchenvironment.hpp"
+
+#include "maskkernel.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    // Increment a cell value, 9 wraps to 1, return the change of the number of cells not equal to 9.
+    int incrementByte(unsigned char &value)
+    {
+        int change = (value == 9) - (value == 8);
+        value = static_cast<unsigned char>(value >= 9 ? 1 : value + 1);
+        return change;
+    }
+}
+
+BatchEnvironment::BatchEnvironment(int boards, int size, int difficulty, int maxMoves)
+    : boards(boards), size(size), cells(size * size), difficulty(difficulty), maxMoves(maxMoves), randomStream(0),
+      randomEngine(GameRandom::Engine::Xoshiro), maskStride(0)
+{
+    if (boards < 1 || size < 1 || size > MAX_SIZE)
+    {
+        throw std::out_of_range("Cannot create " + std::to_string(boards) + " boards of size " + std::to_string(size));
+    }
+    if (difficulty <= 0 || difficulty > cells || maxMoves < 0)
+    {
+        throw std::out_of_range("Cannot create boards with difficulty " + std::to_string(difficulty) + " and move limit " +
+                                std::to_string(maxMoves));
+    }
+    values.assign(static_cast<std::size_t>(boards) * cells + MASK_VECTOR_BYTES, 9);
+    unsolved.assign(boards, 0);
+    moves.assign(boards, 0);
+    finished.assign(boards, 1);
+    generated.resize(cells);
+
+    if (MASK_VECTOR_BYTES > 1 && size <= VECTOR_MAX_SIZE)
+    {
+        maskStride = (cells + MASK_VECTOR_BYTES - 1) / MASK_VECTOR_BYTES * MASK_VECTOR_BYTES;
+        masks.assign(cells * maskStride, 0);
+        for (int action = 0; action < cells; ++action)
+        {
+            for (int i = 0; i < cells; ++i)
+            {
+                masks[action * maskStride + i] = i / size == action / size || i % size == action % size;
+            }
+        }
+    }
+}
+
+void BatchEnvironment::setRandomStream(uint64_t stream, GameRandom::Engine engine)
+{
+    randomStream = stream;
+    randomEngine = engine;
+}
+
+void BatchEnvironment::reset(const uint64_t *seeds)
+{
+    for (int board = 0; board < boards; ++board)
+    {
+        reset(board, seeds[board]);
+    }
+}
+
+void BatchEnvironment::reset(int board, uint64_t seed)
+{
+    if (board < 0 || board >= boards)
+    {
+        throw std::out_of_range("Cannot reset board " + std::to_string(board));
+    }
+    GameRandom random(seed, randomStream, randomEngine);
+    GameLogic::generateBoard(size, difficulty, random, generated.data());
+    unsigned char *cell = &values[static_cast<std::size_t>(board) * cells];
+    int count = 0;
+    for (int i = 0; i < cells; ++i)
+    {
+        cell[i] = static_cast<unsigned char>(generated[i]);
+        count += generated[i] != 9;
+    }
+    unsolved[board] = count;
+    moves[board] = 0;
+    finished[board] = count == 0;
+}
+
+void BatchEnvironment::step(const int *actions, float *rewards, unsigned char *done)
+{
+    for (int board = 0; board < boards; ++board)
+    {
+        if (actions[board] >= cells)
+        {
+            throw std::out_of_range("Cannot play move " + std::to_string(actions[board]) + " on board " + std::to_string(board));
+        }
+    }
+
+    // Number of boards the vectors of one board reach into, one pass steps every spread-th board.
+    int spread = masks.empty() ? 1 : static_cast<int>((maskStride + cells - 1) / cells);
+    for (int first = 0; first < spread; ++first)
+    {
+        for (int board = first; board < boards; board += spread)
+        {
+            rewards[board] = 0.0f;
+            int action = actions[board];
+            if (action >= 0 && !finished[board])
+            {
+                unsolved[board] += masks.empty() ? stepLines(board, action) : stepMasked(board, action);
+                ++moves[board];
+                if (unsolved[board] == 0)
+                {
+                    rewards[board] = WIN_REWARD;
+                    finished[board] = 1;
+                }
+                else if (maxMoves != 0 && moves[board] >= maxMoves)
+                {
+                    finished[board] = 1;
+                }
+            }
+            done[board] = finished[board];
+        }
+    }
+}
+
+int BatchEnvironment::stepMasked(int board, int action)
+{
+    unsigned char *cell = &values[static_cast<std::size_t>(board) * cells];
+    const unsigned char *mask = &masks[action * maskStride];
+    int change = 0;
+    for (std::size_t offset = 0; offset < maskStride; offset += MASK_VECTOR_BYTES)
+    {
+        change += addMask(cell + offset, mask + offset);
+    }
+    return change;
+}
+
+int BatchEnvironment::stepLines(int board, int action)
+{
+    unsigned char *cell = &values[static_cast<std::size_t>(board) * cells];
+    int row = action / size;
+    int col = action % size;
+    int change = 0;
+    unsigned char *line = cell + row * size;
+    for (int i = 0; i < size; ++i)
+    {
+        change += incrementByte(line[i]);
+    }
+    for (int i = 0; i < size; ++i)
+    {
+        if (i != row) // The crossing cell was incremented with the row.
+        {
+            change += incrementByte(cell[i * size + col]);
+        }
+    }
+    return change;
+}
+
+const unsigned char *BatchEnvironment::observations() const
+{
+    return values.data();
+}
+
+int BatchEnvironment::getNumMoves(int board) const
+{
+    return moves.at(board);
+}
+
+bool BatchEnvironment::isWin(int board) const
+{
+    return unsolved.at(board) == 0;
+}
+
+int BatchEnvironment::getBoardCount() const
+{
+    return boards;
+}
+
+int BatchEnvironment::getSize() const
+{
+    return size;
+}
+
+const char *BatchEnvironment::getKernelName()
+{
+    return maskKernelName();
+}
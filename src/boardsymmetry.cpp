@@ -0,0 +1,283 @@
+/**
+ * @file boardsymmetry.cpp
+ * @brief Implementation of BoardSymmetry class methods.
+ *
+ * The canonical form is searched row by row. Columns are kept in an ordered
+ * partition of blocks whose order is fixed but whose columns inside a block
+ * can still be swapped. The smallest next row any unused board row can give
+ * is its values sorted inside every block. Rows that give the smallest one
+ * are tried in turn, each splits the blocks by its values. Branches whose
+ * rows so far are larger than the best form found are cut, and of identical
+ * board rows only the first unused one is tried. Random boards rarely tie,
+ * so the search is close to size^3 steps per orientation.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "boardsymmetry.hpp"
+
+#include "boardhash.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    // Depth-first search for the smallest form of a board in one orientation, keeping the best over orientations.
+    // Specialized for every size like BoardKernel, so the short loops over a line are unrolled.
+    template <int SIZE>
+    class Search
+    {
+    public:
+        Search() : haveBest(false), bestTransposed(false), board(nullptr), transposed(false) {}
+
+        void run(const int *board, bool transposed)
+        {
+            this->board = board;
+            this->transposed = transposed;
+            for (int r = 0; r < size; ++r)
+            {
+                used[r] = false;
+                sameAs[r] = -1;
+                for (int s = r - 1; s >= 0 && sameAs[r] < 0; --s)
+                {
+                    if (std::equal(board + r * size, board + (r + 1) * size, board + s * size))
+                    {
+                        sameAs[r] = s;
+                    }
+                }
+                levelCols[0][r] = r;
+                levelBlocks[0][r] = 0; // One block of all columns.
+            }
+            descend(0);
+        }
+
+        bool haveBest;
+        bool bestTransposed;
+        uint32_t best[SIZE]; // Rows of the best form, 4 bits per value, first column in the highest bits.
+        int bestRows[SIZE];
+        int bestCols[SIZE];
+
+    private:
+        void descend(int depth)
+        {
+            if (depth == size)
+            {
+                if (!haveBest || std::lexicographical_compare(current, current + size, best, best + size))
+                {
+                    haveBest = true;
+                    bestTransposed = transposed;
+                    std::copy(current, current + size, best);
+                    std::copy(currentRows, currentRows + size, bestRows);
+                    std::copy(levelCols[size], levelCols[size] + size, bestCols); // Columns left in a block are equal.
+                }
+                return;
+            }
+
+            uint32_t candidate[SIZE];
+            uint32_t smallest = UINT32_MAX;
+            for (int r = 0; r < size; ++r)
+            {
+                if (used[r] || (sameAs[r] >= 0 && !used[sameAs[r]]))
+                {
+                    continue; // Used, or an identical row would give the same forms.
+                }
+                candidate[r] = sortedRow(depth, r);
+                smallest = std::min(smallest, candidate[r]);
+            }
+            current[depth] = smallest;
+            for (int r = 0; r < size; ++r)
+            {
+                if (used[r] || (sameAs[r] >= 0 && !used[sameAs[r]]) || candidate[r] != smallest)
+                {
+                    continue;
+                }
+                if (haveBest && std::lexicographical_compare(best, best + depth + 1, current, current + depth + 1))
+                {
+                    return; // Every row left gives the same prefix, which is already larger than the best form.
+                }
+                refine(depth, r);
+                used[r] = true;
+                currentRows[depth] = r;
+                descend(depth + 1);
+                used[r] = false;
+            }
+        }
+
+        // Values of a row in the column order of a level, sorted inside every block.
+        uint32_t sortedRow(int depth, int row) const
+        {
+            const int *cols = levelCols[depth];
+            const int *line = board + row * size;
+            unsigned keys[SIZE];
+            for (int i = 0; i < size; ++i)
+            {
+                keys[i] = levelBlocks[depth][i] << 8 | static_cast<unsigned>(line[cols[i]]) << 4;
+            }
+            if (size <= 4 || levelBlocks[depth][size - 1] != size - 1) // Blocks of one column are sorted, worth checking on larger boards.
+            {
+                sortKeys(keys, size);
+            }
+            uint32_t packed = 0;
+            for (int i = 0; i < size; ++i)
+            {
+                packed = packed << 4 | (keys[i] >> 4 & 15);
+            }
+            return packed;
+        }
+
+        // Order the columns of every block by the values of a row and split blocks where the values change.
+        void refine(int depth, int row)
+        {
+            const int *cols = levelCols[depth];
+            const int *line = board + row * size;
+            unsigned keys[SIZE];
+            for (int i = 0; i < size; ++i)
+            {
+                keys[i] = levelBlocks[depth][i] << 8 | static_cast<unsigned>(line[cols[i]]) << 4 | static_cast<unsigned>(cols[i]);
+            }
+            if (size <= 4 || levelBlocks[depth][size - 1] != size - 1)
+            {
+                sortKeys(keys, size);
+            }
+            unsigned block = 0;
+            for (int i = 0; i < size; ++i)
+            {
+                block += i > 0 && keys[i] >> 4 != keys[i - 1] >> 4; // New block where the block or the value changes.
+                levelCols[depth + 1][i] = static_cast<int>(keys[i] & 15);
+                levelBlocks[depth + 1][i] = block;
+            }
+        }
+
+        // Sort a few keys with a fixed sequence of compare-exchanges, random boards would mispredict most
+        // branches of an insertion sort. Keys start with the block, so no value leaves its block.
+        static void sortKeys(unsigned *keys, int count)
+        {
+            for (int pass = 0; pass < count; ++pass)
+            {
+                for (int i = pass & 1; i + 1 < count; i += 2)
+                {
+                    unsigned low = std::min(keys[i], keys[i + 1]);
+                    keys[i + 1] = std::max(keys[i], keys[i + 1]);
+                    keys[i] = low;
+                }
+            }
+        }
+
+        static constexpr int size = SIZE;
+        const int *board; // Row-major board of the orientation.
+        bool transposed;
+        bool used[SIZE];
+        int sameAs[SIZE]; // Nearest earlier identical row, -1 if none.
+        uint32_t current[SIZE];
+        int currentRows[SIZE];
+        int levelCols[SIZE + 1][SIZE];        // Column order after each chosen row.
+        unsigned levelBlocks[SIZE + 1][SIZE]; // Block of every position of levelCols.
+    };
+}
+
+BoardSymmetry::Canonical BoardSymmetry::canonicalize(const int *values, int size)
+{
+    if (size < 1 || size > MAX_CANONICAL_SIZE)
+    {
+        throw std::out_of_range("Cannot canonicalize board of size " + std::to_string(size));
+    }
+    int transposed[MAX_CANONICAL_SIZE * MAX_CANONICAL_SIZE];
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            transposed[col * size + row] = values[row * size + col];
+        }
+    }
+    Canonical canonical;
+    auto search = [&](auto sized)
+    {
+        sized.run(values, false);
+        sized.run(transposed, true);
+        canonical.transform.transposed = sized.bestTransposed;
+        canonical.transform.rows.assign(sized.bestRows, sized.bestRows + size);
+        canonical.transform.cols.assign(sized.bestCols, sized.bestCols + size);
+    };
+    switch (size)
+    {
+    case 1:
+        search(Search<1>());
+        break;
+    case 2:
+        search(Search<2>());
+        break;
+    case 3:
+        search(Search<3>());
+        break;
+    case 4:
+        search(Search<4>());
+        break;
+    case 5:
+        search(Search<5>());
+        break;
+    case 6:
+        search(Search<6>());
+        break;
+    case 7:
+        search(Search<7>());
+        break;
+    default:
+        search(Search<8>());
+        break;
+    }
+    canonical.values.resize(static_cast<std::size_t>(size) * size);
+    apply(canonical.transform, values, canonical.values.data());
+    canonical.key = hashBoard(canonical.values.data(), size);
+    return canonical;
+}
+
+BoardSymmetry::Canonical BoardSymmetry::canonicalize(const GameLogic &game)
+{
+    int size = game.getSize();
+    if (size > MAX_CANONICAL_SIZE)
+    {
+        throw std::out_of_range("Cannot canonicalize board of size " + std::to_string(size));
+    }
+    int values[MAX_CANONICAL_SIZE * MAX_CANONICAL_SIZE];
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            values[row * size + col] = game.getBoardValue({row, col});
+        }
+    }
+    return canonicalize(values, size);
+}
+
+void BoardSymmetry::apply(const Transform &transform, const int *values, int *out)
+{
+    int size = static_cast<int>(transform.rows.size());
+    for (int i = 0; i < size; ++i)
+    {
+        for (int j = 0; j < size; ++j)
+        {
+            int row = transform.transposed ? transform.cols[j] : transform.rows[i];
+            int col = transform.transposed ? transform.rows[i] : transform.cols[j];
+            out[i * size + j] = values[row * size + col];
+        }
+    }
+}
+
+GameLogic::Move BoardSymmetry::toCanonical(const Transform &transform, GameLogic::Move move)
+{
+    int first = transform.transposed ? move.col : move.row; // Row of the move in the orientation.
+    int second = transform.transposed ? move.row : move.col;
+    int row = static_cast<int>(std::find(transform.rows.begin(), transform.rows.end(), first) - transform.rows.begin());
+    int col = static_cast<int>(std::find(transform.cols.begin(), transform.cols.end(), second) - transform.cols.begin());
+    return {row, col};
+}
+
+GameLogic::Move BoardSymmetry::fromCanonical(const Transform &transform, GameLogic::Move move)
+{
+    int row = transform.rows.at(move.row);
+    int col = transform.cols.at(move.col);
+    return transform.transposed ? GameLogic::Move{col, row} : GameLogic::Move{row, col};
+}
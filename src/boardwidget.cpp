@@ -0,0 +1,442 @@
+/**
+ * @file boardwidget.cpp
+ * @brief Implementation of BoardWidget class from boardwidget.hpp
+ *
+ * A paint only walks the cells inside the repainted rectangle: cell colors
+ * are one scaled drawImage() call, grid lines and values are only drawn
+ * when cells are large enough to show them, so the cost of a paint is
+ * bounded by the widget size and not by the board size.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+
+#include "boardwidget.hpp"
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QResizeEvent>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr GameLogic::Move NO_CELL = {-1, -1};
+    constexpr double ZOOM_STEP = 1.25; // Zoom factor of one wheel notch.
+
+    bool isSameCell(GameLogic::Move a, GameLogic::Move b)
+    {
+        return a.row == b.row && a.col == b.col;
+    }
+
+    // Position of a mouse event in widget coordinates, position() only exists since Qt 6.
+    QPointF positionOf(const QMouseEvent *event)
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        return event->position();
+#else
+        return event->localPos();
+#endif
+    }
+}
+
+BoardWidget::BoardWidget(QWidget *parent)
+    : QWidget(parent), game(nullptr), size(0), colorsShown(true), cellSize(1), fitted(true),
+      hovered(NO_CELL), hint(NO_CELL), pressed(NO_CELL), panning(false)
+{
+    setMouseTracking(true);                  // Hover follows the mouse without a pressed button.
+    setAttribute(Qt::WA_OpaquePaintEvent);   // paintEvent() fills every pixel it is asked to repaint.
+}
+
+void BoardWidget::setGame(const GameLogic *game)
+{
+    this->game = game;
+    size = -1; // Force a full reload.
+    refresh();
+}
+
+void BoardWidget::refresh()
+{
+    int gameSize = game ? game->getSize() : 0;
+    if (gameSize != size)
+    {
+        size = gameSize;
+        shown.assign(static_cast<std::size_t>(size) * size, 0);
+        cells = size > 0 ? QImage(size, size, QImage::Format_RGB32) : QImage();
+        for (int cell = 0; cell < size * size; ++cell)
+        {
+            shown[cell] = static_cast<unsigned char>(game->getBoardValue({cell / size, cell % size}));
+        }
+        paintImage();
+        hovered = NO_CELL;
+        hint = NO_CELL;
+        pressed = NO_CELL;
+        fitted = true;
+        cellSize = fitCellSize();
+        clampOffset();
+        update();
+        return;
+    }
+
+    // Changes are repainted as their bounding rectangle, only its visible part is painted.
+    int firstRow = size, firstCol = size, lastRow = -1, lastCol = -1;
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            if (storeValue(row * size + col, game->getBoardValue({row, col})))
+            {
+                firstRow = std::min(firstRow, row);
+                firstCol = std::min(firstCol, col);
+                lastRow = std::max(lastRow, row);
+                lastCol = std::max(lastCol, col);
+            }
+        }
+    }
+    if (lastRow >= 0)
+    {
+        updateCells(firstRow, firstCol, lastRow, lastCol);
+    }
+}
+
+void BoardWidget::refreshLines(GameLogic::Move move)
+{
+    if (!game || game->getSize() != size || move.row < 0 || move.col < 0 || move.row >= size || move.col >= size)
+    {
+        refresh();
+        return;
+    }
+    for (int col = 0; col < size; ++col)
+    {
+        storeValue(move.row * size + col, game->getBoardValue({move.row, col}));
+    }
+    for (int row = 0; row < size; ++row)
+    {
+        storeValue(row * size + move.col, game->getBoardValue({row, move.col}));
+    }
+    updateCells(move.row, 0, move.row, size - 1);
+    updateCells(0, move.col, size - 1, move.col);
+}
+
+bool BoardWidget::storeValue(int cell, int value)
+{
+    if (shown[cell] == value)
+    {
+        return false;
+    }
+    shown[cell] = static_cast<unsigned char>(value);
+    reinterpret_cast<QRgb *>(cells.scanLine(cell / size))[cell % size] = getColorForValue(colorsShown ? value : 0).rgb();
+    return true;
+}
+
+void BoardWidget::paintImage()
+{
+    for (int row = 0; row < size; ++row)
+    {
+        QRgb *line = reinterpret_cast<QRgb *>(cells.scanLine(row));
+        for (int col = 0; col < size; ++col)
+        {
+            line[col] = getColorForValue(colorsShown ? shown[row * size + col] : 0).rgb();
+        }
+    }
+}
+
+void BoardWidget::setColorsShown(bool shown)
+{
+    colorsShown = shown;
+    paintImage();
+    update();
+}
+
+void BoardWidget::setHint(GameLogic::Move move)
+{
+    clearHint();
+    if (move.row >= 0 && move.col >= 0 && move.row < size && move.col < size)
+    {
+        hint = move;
+        updateCells(move.row, move.col, move.row, move.col);
+    }
+}
+
+void BoardWidget::clearHint()
+{
+    if (hint.row >= 0)
+    {
+        updateCells(hint.row, hint.col, hint.row, hint.col);
+        hint = NO_CELL;
+    }
+}
+
+int BoardWidget::getShownValue(GameLogic::Move move) const
+{
+    if (move.row < 0 || move.col < 0 || move.row >= size || move.col >= size)
+    {
+        return 0;
+    }
+    return shown[move.row * size + move.col];
+}
+
+GameLogic::Move BoardWidget::cellAt(QPointF position) const
+{
+    if (size == 0)
+    {
+        return NO_CELL;
+    }
+    double col = std::floor((position.x() + offset.x()) / cellSize);
+    double row = std::floor((position.y() + offset.y()) / cellSize);
+    if (row < 0 || col < 0 || row >= size || col >= size)
+    {
+        return NO_CELL;
+    }
+    return {static_cast<int>(row), static_cast<int>(col)};
+}
+
+QRectF BoardWidget::cellRect(GameLogic::Move move) const
+{
+    return QRectF(move.col * cellSize - offset.x(), move.row * cellSize - offset.y(), cellSize, cellSize);
+}
+
+double BoardWidget::fitCellSize() const
+{
+    if (size == 0)
+    {
+        return 1;
+    }
+    return std::max(0.01, std::min(width(), height()) / static_cast<double>(size));
+}
+
+void BoardWidget::clampOffset()
+{
+    double extent = cellSize * size;
+    auto clampAxis = [extent](double value, double length)
+    {
+        return extent <= length ? (extent - length) / 2 : std::clamp(value, 0.0, extent - length);
+    };
+    offset = QPointF(clampAxis(offset.x(), width()), clampAxis(offset.y(), height()));
+}
+
+void BoardWidget::zoomTo(double cellSize, QPointF anchor)
+{
+    double fit = fitCellSize();
+    cellSize = std::clamp(cellSize, fit, std::max(fit, MAX_CELL_SIZE));
+    QPointF board = (anchor + offset) / this->cellSize; // Anchor in cells, kept under the anchor.
+    this->cellSize = cellSize;
+    offset = board * cellSize - anchor;
+    fitted = cellSize <= fit;
+    clampOffset();
+    update();
+}
+
+void BoardWidget::updateCells(int firstRow, int firstCol, int lastRow, int lastCol)
+{
+    QRectF area = cellRect({firstRow, firstCol}).united(cellRect({lastRow, lastCol}));
+    update(area.toAlignedRect().adjusted(-1, -1, 1, 1)); // Borders of the overlays reach into the next pixel.
+}
+
+void BoardWidget::updateLines(GameLogic::Move move)
+{
+    if (move.row >= 0)
+    {
+        updateCells(move.row, 0, move.row, size - 1);
+        updateCells(0, move.col, size - 1, move.col);
+    }
+}
+
+void BoardWidget::setHovered(GameLogic::Move move)
+{
+    if (isSameCell(move, hovered))
+    {
+        return;
+    }
+    updateLines(hovered);
+    hovered = move;
+    updateLines(hovered);
+}
+
+void BoardWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    QRect area = event->rect();
+    painter.fillRect(area, palette().window());
+    if (size == 0)
+    {
+        return;
+    }
+
+    // Cells inside the repainted rectangle.
+    int firstCol = std::max(0, static_cast<int>(std::floor((area.left() + offset.x()) / cellSize)));
+    int firstRow = std::max(0, static_cast<int>(std::floor((area.top() + offset.y()) / cellSize)));
+    int lastCol = std::min(size - 1, static_cast<int>(std::floor((area.right() + offset.x()) / cellSize)));
+    int lastRow = std::min(size - 1, static_cast<int>(std::floor((area.bottom() + offset.y()) / cellSize)));
+    if (firstCol > lastCol || firstRow > lastRow)
+    {
+        return;
+    }
+    int cols = lastCol - firstCol + 1;
+    int rows = lastRow - firstRow + 1;
+    QRectF target(firstCol * cellSize - offset.x(), firstRow * cellSize - offset.y(), cols * cellSize, rows * cellSize);
+    painter.drawImage(target, cells, QRectF(firstCol, firstRow, cols, rows)); // Without smoothing every cell stays one flat color.
+
+    if (cellSize >= GRID_CELL_SIZE)
+    {
+        std::vector<QLineF> lines;
+        lines.reserve(cols + rows + 2);
+        for (int col = firstCol; col <= lastCol + 1; ++col)
+        {
+            double x = col * cellSize - offset.x();
+            lines.emplace_back(x, target.top(), x, target.bottom());
+        }
+        for (int row = firstRow; row <= lastRow + 1; ++row)
+        {
+            double y = row * cellSize - offset.y();
+            lines.emplace_back(target.left(), y, target.right(), y);
+        }
+        painter.setPen(QPen(Qt::gray, 1));
+        painter.drawLines(lines.data(), static_cast<int>(lines.size()));
+    }
+
+    if (cellSize >= TEXT_CELL_SIZE)
+    {
+        static const QString digits[10] = {"", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
+        QFont font = painter.font();
+        font.setPixelSize(static_cast<int>(cellSize * 0.45));
+        painter.setFont(font);
+        painter.setPen(Qt::black);
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            for (int col = firstCol; col <= lastCol; ++col)
+            {
+                painter.drawText(cellRect({row, col}), Qt::AlignCenter, digits[shown[row * size + col]]);
+            }
+        }
+    }
+
+    // Overlays: hover marks the row and column a click on the cell changes, the hint frames one cell.
+    double border = std::clamp(cellSize / 16, 1.0, 5.0);
+    if (hovered.row >= 0)
+    {
+        QRectF row = cellRect({hovered.row, 0}).united(cellRect({hovered.row, size - 1}));
+        QRectF col = cellRect({0, hovered.col}).united(cellRect({size - 1, hovered.col}));
+        painter.fillRect(row, QColor(255, 0, 0, 40));
+        painter.fillRect(col, QColor(255, 0, 0, 40)); // The clicked cell itself is tinted twice.
+        painter.setPen(QPen(Qt::red, border));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawRect(row.adjusted(border / 2, border / 2, -border / 2, -border / 2));
+        painter.drawRect(col.adjusted(border / 2, border / 2, -border / 2, -border / 2));
+    }
+    if (hint.row >= 0)
+    {
+        painter.setPen(QPen(Qt::yellow, border));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawRect(cellRect(hint).adjusted(border / 2, border / 2, -border / 2, -border / 2));
+    }
+
+    if (!isEnabled())
+    {
+        painter.fillRect(area, QColor(255, 255, 255, 96)); // A won board is shown faded until the next game.
+    }
+}
+
+void BoardWidget::resizeEvent(QResizeEvent *event)
+{
+    double fit = fitCellSize();
+    if (fitted || cellSize < fit)
+    {
+        cellSize = fit;
+        fitted = true;
+    }
+    clampOffset();
+    QWidget::resizeEvent(event);
+}
+
+void BoardWidget::wheelEvent(QWheelEvent *event)
+{
+    double notches = event->angleDelta().y() / 120.0; // Touchpads send fractions of a notch, so zooming stays smooth.
+    zoomTo(cellSize * std::pow(ZOOM_STEP, notches), event->position());
+    event->accept();
+}
+
+void BoardWidget::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton)
+    {
+        pressed = cellAt(positionOf(event));
+    }
+    else if (event->button() == Qt::RightButton || event->button() == Qt::MiddleButton)
+    {
+        panning = true;
+        panFrom = positionOf(event);
+        setCursor(Qt::ClosedHandCursor);
+    }
+}
+
+void BoardWidget::mouseMoveEvent(QMouseEvent *event)
+{
+    if (panning)
+    {
+        offset -= positionOf(event) - panFrom;
+        panFrom = positionOf(event);
+        clampOffset();
+        update();
+    }
+    setHovered(cellAt(positionOf(event)));
+}
+
+void BoardWidget::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton)
+    {
+        GameLogic::Move move = cellAt(positionOf(event));
+        bool clicked = move.row >= 0 && isSameCell(move, pressed); // Releasing over another cell cancels the click.
+        pressed = NO_CELL;
+        if (clicked)
+        {
+            emit cellClicked(move);
+        }
+    }
+    else if (event->button() == Qt::RightButton || event->button() == Qt::MiddleButton)
+    {
+        panning = false;
+        unsetCursor();
+    }
+}
+
+void BoardWidget::leaveEvent(QEvent *event)
+{
+    setHovered(NO_CELL);
+    QWidget::leaveEvent(event);
+}
+
+void BoardWidget::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::EnabledChange)
+    {
+        setHovered(NO_CELL); // A disabled board gets no mouse events, so the hover would stay.
+        update();
+    }
+    QWidget::changeEvent(event);
+}
+
+QSize BoardWidget::sizeHint() const
+{
+    return QSize(480, 480);
+}
+
+QColor BoardWidget::getColorForValue(int value)
+{
+    static const QColor colors[10] = {
+        QColor(255, 255, 255), // Default color (white)
+        QColor(255, 192, 203), // Pastel Pink
+        QColor(173, 216, 230), // Pastel Cyan
+        QColor(255, 255, 224), // Pastel Yellow
+        QColor(255, 182, 100), // Pastel Red
+        QColor(144, 238, 144), // Pastel Green
+        QColor(255, 218, 185), // Pastel Peach
+        QColor(221, 160, 221), // Pastel Violet
+        QColor(240, 230, 140), // Pastel Olive
+        QColor(255, 160, 122), // Pastel Salmon
+    };
+    return value >= 1 && value <= 9 ? colors[value] : colors[0];
+}
@@ -0,0 +1,221 @@
+/**
+ * @file distancetable.cpp
+ * @brief Implementation of DistanceTable class methods.
+ *
+ * On a 3x3 board the solution is a linear function of the cell values
+ * modulo 9, so the table is generated by walking the indices in order and
+ * updating the press counts incrementally instead of solving every board.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+#include "distancetable.hpp"
+#include "solver.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int CELLS = DistanceTable::SIZE * DistanceTable::SIZE;
+    constexpr int32_t POWERS_OF_9[CELLS] = {1, 9, 81, 729, 6561, 59049, 531441, 4782969, 43046721};
+
+    // Cell of the move with the most presses left in the solver's solution, -1 if the board is won.
+    int solverMove(const int *board)
+    {
+        int presses[CELLS];
+        if (Solver::solve(board, DistanceTable::SIZE, presses) <= 0)
+            return -1;
+        int best = 0;
+        for (int cell = 1; cell < CELLS; ++cell)
+        {
+            if (presses[cell] > presses[best])
+                best = cell;
+        }
+        return best;
+    }
+}
+
+DistanceTable::DistanceTable(const std::string &path) : path(path), entries(nullptr) {}
+
+void DistanceTable::load() const
+{
+    if (!file.open(path))
+        return; // Missing file, queries fall back to the solver.
+
+    uint32_t header[4];
+    uint64_t states;
+    bool valid = file.size() == HEADER_BYTES + STATES;
+    if (valid)
+    {
+        std::memcpy(header, file.data(), sizeof(header));
+        std::memcpy(&states, file.data() + sizeof(header), sizeof(states));
+        valid = header[0] == MAGIC && header[1] == VERSION && header[2] == SIZE && header[3] == 8 && states == STATES;
+    }
+    if (!valid)
+    {
+        file.close();
+        return;
+    }
+    file.adviseRandom(); // Lookups jump all over the table, read-ahead would only waste memory.
+    entries = file.data() + HEADER_BYTES;
+}
+
+bool DistanceTable::isLoaded() const
+{
+    std::call_once(loadFlag, [this]
+                   { load(); });
+    return entries != nullptr;
+}
+
+uint32_t DistanceTable::index(const int *board)
+{
+    uint32_t result = 0;
+    for (int cell = CELLS - 1; cell >= 0; --cell)
+    {
+        result = result * 9 + static_cast<uint32_t>(board[cell] % 9);
+    }
+    return result;
+}
+
+int DistanceTable::distance(const int *board) const
+{
+    if (!isLoaded())
+    {
+        int presses[CELLS];
+        return Solver::solve(board, SIZE, presses);
+    }
+    return entries[index(board)];
+}
+
+int DistanceTable::bestMove(const int *board) const
+{
+    if (!isLoaded())
+    {
+        return solverMove(board);
+    }
+    int32_t current = static_cast<int32_t>(index(board));
+    int left = entries[current];
+    if (left == 0)
+    {
+        return -1;
+    }
+
+    // A move is optimal if the board it leads to is exactly one move closer to the win.
+    for (int move = 0; move < CELLS; ++move)
+    {
+        int row = move / SIZE;
+        int col = move % SIZE;
+        int32_t next = current;
+        for (int cell = 0; cell < CELLS; ++cell)
+        {
+            if (cell / SIZE == row || cell % SIZE == col)
+            {
+                next += (board[cell] % 9 == 8 ? -8 : 1) * POWERS_OF_9[cell]; // Digit goes up by one, 8 wraps to 0.
+            }
+        }
+        if (entries[next] + 1 == left)
+        {
+            return move;
+        }
+    }
+    return solverMove(board); // Table does not match the rules, trust the solver.
+}
+
+void DistanceTable::fill(unsigned char *entries, uint64_t begin, uint64_t end)
+{
+    // Presses needed for a board with a single cell at value 1 (digit 1), i.e. one column of the linear solution.
+    unsigned char columns[CELLS][CELLS];
+    for (int cell = 0; cell < CELLS; ++cell)
+    {
+        int board[CELLS] = {9, 9, 9, 9, 9, 9, 9, 9, 9};
+        int presses[CELLS];
+        board[cell] = 1;
+        Solver::solve(board, SIZE, presses);
+        for (int i = 0; i < CELLS; ++i)
+        {
+            columns[cell][i] = static_cast<unsigned char>(presses[i]);
+        }
+    }
+
+    // Press counts of the first board in the range.
+    unsigned char digits[CELLS];
+    unsigned char presses[CELLS] = {};
+    uint64_t rest = begin;
+    for (int cell = 0; cell < CELLS; ++cell)
+    {
+        digits[cell] = static_cast<unsigned char>(rest % 9);
+        rest /= 9;
+        for (int i = 0; i < CELLS; ++i)
+        {
+            presses[i] = static_cast<unsigned char>((presses[i] + digits[cell] * columns[cell][i]) % 9);
+        }
+    }
+
+    for (uint64_t index = begin; index < end; ++index)
+    {
+        int total = 0;
+        for (int i = 0; i < CELLS; ++i)
+        {
+            total += presses[i];
+        }
+        *entries++ = static_cast<unsigned char>(total);
+
+        // Next index: every digit that goes up by one (including carries) adds its column once more.
+        for (int cell = 0; cell < CELLS; ++cell)
+        {
+            for (int i = 0; i < CELLS; ++i)
+            {
+                unsigned char value = static_cast<unsigned char>(presses[i] + columns[cell][i]);
+                presses[i] = value >= 9 ? value - 9 : value;
+            }
+            if (++digits[cell] < 9)
+                break;
+            digits[cell] = 0;
+        }
+    }
+}
+
+bool DistanceTable::generate(const std::string &path, int threads)
+{
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    std::string temporary = path + ".tmp"; // Readers never see a half-written table.
+    MappedFile out;
+    if (!out.create(temporary, HEADER_BYTES + STATES))
+    {
+        return false;
+    }
+
+    uint32_t header[4] = {MAGIC, VERSION, SIZE, 8};
+    uint64_t states = STATES;
+    std::memcpy(out.data(), header, sizeof(header));
+    std::memcpy(out.data() + sizeof(header), &states, sizeof(states));
+
+    std::vector<std::thread> workers;
+    unsigned char *first = out.data() + HEADER_BYTES;
+    for (int i = 0; i < threads; ++i)
+    {
+        uint64_t begin = STATES * i / threads;
+        uint64_t end = STATES * (i + 1) / threads;
+        workers.emplace_back([first, begin, end]
+                             { fill(first + begin, begin, end); });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    bool flushed = out.flush(); // Only a table that reached the disk replaces the old one.
+    out.close();
+    if (!flushed)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return MappedFile::replace(temporary, path);
+}
@@ -9,27 +9,158 @@
  * checking win conditions, and providing hints for the next move.
  *
  * @author Ignat Romanov
- * @version 1.1
- * @date 20.11.2024
+ * @version 1.2
+ * @date 16.10.2026
  */
 #include "gamelogic.hpp"
+#include "boardhash.hpp"
+#include "boardkernel.hpp"
+#include "distancetable.hpp"
+#include "hintcache.hpp"
+#include "mappedfile.hpp"
+#include "movelog.hpp"
+#include "solver.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <random>
 
-GameLogic::GameLogic()
+namespace
 {
-    for (auto &row : board)
+    // Snapshot layout, little-endian: SnapshotHeader, board (size*size bytes, padded to 8), history (Move per move),
+    // checkpoints (size*size bytes per checkpoint).
+    constexpr uint32_t SNAPSHOT_MAGIC = 0x53533954; // "T9SS"
+    constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+    constexpr int MIN_CACHED_SIZE = 4; // Smaller boards are solved faster than looked up in the hint cache.
+
+    enum SnapshotFlags : uint32_t
+    {
+        SNAPSHOT_CAN_HINT = 1,
+        SNAPSHOT_CAN_UNDO = 2,
+        SNAPSHOT_CAN_REDO = 4,
+        SNAPSHOT_PACKED = 8,
+        SNAPSHOT_TILED = 16,
+        SNAPSHOT_LAZY = 32,
+    };
+
+    struct SnapshotHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t size;
+        uint32_t difficulty;
+        uint32_t numMoves;
+        uint32_t historySize;
+        uint32_t checkpointInterval;
+        uint32_t flags;
+        uint64_t seed;
+        uint64_t checkpointBytes;
+    };
+    static_assert(sizeof(SnapshotHeader) == 48, "Snapshot header must have no padding");
+
+    std::size_t boardBytes(uint32_t size)
+    {
+        return (static_cast<std::size_t>(size) * size + 7) / 8 * 8; // Keeps the history 8-byte aligned.
+    }
+
+    // Press moves on a row-major board in range [1, 9] the way GameLogic::pressHistory() does, for moves that are not in a history yet.
+    void pressMoves(std::vector<int> &values, int size, const GameLogic::Move *moves, std::size_t count, bool reverse)
+    {
+        std::vector<int> rowPresses(size, 0);
+        std::vector<int> colPresses(size, 0);
+        int step = reverse ? 8 : 1;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            rowPresses[moves[i].row] = (rowPresses[moves[i].row] + step) % 9;
+            colPresses[moves[i].col] = (colPresses[moves[i].col] + step) % 9;
+            int &cell = values[moves[i].row * size + moves[i].col];
+            cell = (cell - 1 + 9 - step) % 9 + 1; // Crossing cell gets one step less.
+        }
+        for (int row = 0; row < size; ++row)
+        {
+            for (int col = 0; col < size; ++col)
+            {
+                int &cell = values[row * size + col];
+                cell = (cell - 1 + rowPresses[row] + colPresses[col]) % 9 + 1;
+            }
+        }
+    }
+
+    // Cell that has to be pressed the most times in a solution, the best next move. {-1, -1} if no cell is pressed.
+    GameLogic::Move mostPressed(const int *presses, int size)
     {
-        for (auto &value : row)
+        int maxPresses = 0;
+        GameLogic::Move bestMove = {-1, -1};
+        for (int i = 0; i < size; ++i)
         {
-            value = 9; // Set all values of board to 9 for testing purposes.
+            for (int j = 0; j < size; ++j)
+            {
+                if (presses[i * size + j] > maxPresses)
+                {
+                    maxPresses = presses[i * size + j];
+                    bestMove = {i, j};
+                }
+            }
         }
+        return bestMove;
     }
 
+    // Best next move on a 3x3 board from a distance table lookup, no solving.
+    GameLogic::Move tableMove(const DistanceTable &table, const int *cells)
+    {
+        int cell = table.bestMove(cells);
+        if (cell < 0)
+        {
+            throw std::runtime_error("Cannot hint a move, the board is already solved or has no solution.");
+        }
+        return {cell / DistanceTable::SIZE, cell % DistanceTable::SIZE};
+    }
+
+    // Change of the board hash by a move, from the values of its row and column before the move.
+    template <typename Value>
+    uint64_t hashChange(int size, GameLogic::Move move, bool reverse, Value value)
+    {
+        uint64_t change = 0;
+        for (int i = 0; i < size; ++i)
+        {
+            change ^= boardHashStep(boardHashCellKey(size, move.row * size + i), value(move.row, i), reverse);
+        }
+        for (int i = 0; i < size; ++i)
+        {
+            change ^= boardHashStep(boardHashCellKey(size, i * size + move.col), value(i, move.col), reverse);
+        }
+        // The crossing cell was hashed twice, i.e. not at all.
+        return change ^ boardHashStep(boardHashCellKey(size, move.row * size + move.col), value(move.row, move.col), reverse);
+    }
+}
+
+GameLogic::GameLogic(int size)
+{
+    if (size < 1 || size > MAX_SIZE)
+    {
+        throw std::out_of_range("Cannot create board of size " + std::to_string(size));
+    }
+    this->size = size;
+    storage = Storage::Dense;
+    resetBoard(); // Set all values of board to 9 for testing purposes.
+    resetHistory();
+
     current_difficulty = 1; // Set difficulty to 1
     num_moves = 0;          // Set number of moves to 0
 
+    // Only the generator of seeds asks the hardware, every board has its own cheap generator.
+    std::random_device rd;
+    seeds.seed((static_cast<uint64_t>(rd()) << 32) | rd());
+    seed = 0;
+    seedSet = false;
+    randomStream = 0;
+    randomEngine = GameRandom::Engine::Xoshiro;
+
     // Set all booleans for actions to false; during GameLogic::init() canHint will be set to true
     canHint = false;
     canRedo = false;
@@ -43,13 +174,9 @@ GameLogic::~GameLogic()
 // Check if game is won, i.e. all values are 9
 bool GameLogic::isWin()
 {
-    for (const auto &row : board)
+    if (!isSolved())
     {
-        for (const auto &value : row) // Get value from all rows.
-        {
-            if (value != 9)
-                return false; // False if any value not equal to 9.
-        }
+        return false; // False if any value not equal to 9.
     }
     // If game is won set actions to false.
     canRedo = false;
@@ -61,121 +188,266 @@ bool GameLogic::isWin()
 // Normal move in game which increments by one elements in the same column and row. Changes game state.
 void GameLogic::makeMove(Move move)
 {
-    if (move.row >= MAX_SIZE || move.col >= MAX_SIZE || move.row < 0 || move.col < 0)
+    if (!isInside(move))
     {
         throw std::out_of_range("Cannot play move at row " + std::to_string(move.row) + ", column " + std::to_string(move.col));
     }
-    for (int i = 0; i < MAX_SIZE; ++i)
-    {
-        board[move.row][i] = (board[move.row][i] % 9) + 1; // If value in selected row and column i is greater or equal to 9 set it to 1; increment by 1 otherwise.
-        board[i][move.col] = (board[i][move.col] % 9) + 1; // If value in selected col and row i is greater or equal to 9 set it to 1; increment by 1 otherwise.
-    }
-    ++num_moves;                                                                                  // Increment moves count
-    board[move.row][move.col] <= 1 ? board[move.row][move.col] = 9 : --board[move.row][move.col]; // Handle increment of board[row][col] twice during the loop.
-    historyMoves.push(move);                                                                      // Push current move in undo stack.
-    canUndo = true;                                                                               // After move player can undo.
-    canRedo = false;                                                                              // After move player cannot redo.
+    incrementBoard(move); // Increment values in selected row and column, 9 wraps to 1.
 
-    // Clear redo stack after each normal move.
-    while (!undoHistory.isEmpty())
+    // Moves that could be redone are replaced by the new move, with their checkpoints.
+    history.truncate(num_moves);
+    checkpoints.resize(static_cast<std::size_t>(num_moves / checkpointInterval + 1) * size * size);
+
+    ++num_moves;        // Increment moves count
+    history.push(move); // Push current move in history.
+    saveCheckpoint();
+    if (moveLog)
     {
-        undoHistory.pop();
+        moveLog->recordMove(move.row, move.col);
     }
+    canUndo = true;  // After move player can undo.
+    canRedo = false; // After move player cannot redo.
 }
 
 // Decremental move to init and to undo moves.
 void GameLogic::reverseMove(Move move)
 {
-    if (move.row >= MAX_SIZE || move.col >= MAX_SIZE || move.row < 0 || move.col < 0)
+    if (!isInside(move))
     {
         throw std::out_of_range("Cannot play move at row " + std::to_string(move.row) + ", column " + std::to_string(move.col));
     }
-    for (int i = 0; i < MAX_SIZE; ++i)
-    {
-        board[move.row][i] <= 1 ? board[move.row][i] = 9 : --board[move.row][i]; // If value in selected row and column i is greater or less or equal to 1 set it to 9; decrement by 1 otherwise.
-        board[i][move.col] <= 1 ? board[i][move.col] = 9 : --board[i][move.col]; // If value in selected col and row i is greater or less or equal to 1 set it to 9; decrement by 1 otherwise.
-    }
-    board[move.row][move.col] >= 9 ? board[move.row][move.col] = 1 : ++board[move.row][move.col]; // Handle decrement of board[row][col] twice during the loop.
-    --num_moves;                                                                                  // Decrement moves count by one.
+    decrementBoard(move); // Decrement values in selected row and column, 1 wraps to 9.
+    --num_moves;          // Decrement moves count by one.
 }
 
-// Function for redo action. Uses the same logic as normal move but does not clear the redo stack.
+// Function for redo action. Uses the same logic as normal move but keeps the history.
 void GameLogic::redoMakeMove(Move move)
 {
-    if (move.row >= MAX_SIZE || move.col >= MAX_SIZE || move.row < 0 || move.col < 0)
+    if (!isInside(move))
     {
         throw std::out_of_range("Cannot play move at row " + std::to_string(move.row) + ", column " + std::to_string(move.col));
     }
-    for (int i = 0; i < MAX_SIZE; ++i)
-    {
-        board[move.row][i] = (board[move.row][i] % 9) + 1; // If value in selected row and column i is greater or equal to 9 set it to 1; increment by 1 otherwise.
-        board[i][move.col] = (board[i][move.col] % 9) + 1; // If value in selected col and row i is greater or equal to 9 set it to 1; increment by 1 otherwise.
-    }
+    incrementBoard(move); // Increment values in selected row and column, 9 wraps to 1.
     ++num_moves;
-    board[move.row][move.col] <= 1 ? board[move.row][move.col] = 9 : --board[move.row][move.col]; // Handle increment of board[row][col] twice during the loop.
-    historyMoves.push(move);                                                                      // Push move in undo stack.
     canUndo = true;
 }
 
 // Getter function for gui
 int GameLogic::getBoardValue(Move move) const
 {
-    if (!(move.row >= MAX_SIZE || move.col >= MAX_SIZE || move.row < 0 || move.col < 0))
+    if (isInside(move))
     {
-        return board[move.row][move.col]; // Return board value in a given row and column.
+        if (storage == Storage::Packed)
+        {
+            return packed.value(move.row, move.col);
+        }
+        if (storage == Storage::Tiled)
+        {
+            return tiled.value(move.row, move.col);
+        }
+        if (storage == Storage::Lazy)
+        {
+            return lazy.value(move.row, move.col);
+        }
+        return board[move.row * size + move.col]; // Return board value in a given row and column.
     }
     throw std::out_of_range("Cannot get value at row " + std::to_string(move.row) + ", column " + std::to_string(move.col));
 }
 
-// Initialize game with random moves with set difficulty.
+uint64_t GameLogic::stateHash() const
+{
+    if (!hashValid)
+    {
+        hash = 0;
+        for (int row = 0; row < size; ++row)
+        {
+            for (int col = 0; col < size; ++col)
+            {
+                hash ^= boardHashKey(boardHashCellKey(size, row * size + col), getBoardValue({row, col}));
+            }
+        }
+        hashValid = true;
+    }
+    return hash;
+}
+
+// Initialize game with a board whose optimal solution is exactly the set difficulty.
 void GameLogic::init()
 {
-    if (current_difficulty > MAX_SIZE * MAX_SIZE)
+    if (current_difficulty > size * size)
     {
         current_difficulty = 1;
         throw std::out_of_range("Cannot initialize game with difficulty " + std::to_string(current_difficulty));
     }
-    for (auto &row : board)
+
+    stopMoveLog(); // The log belongs to the previous board.
+    if (!seedSet)
     {
-        for (auto &value : row)
-        {
-            value = 9; // Set all values of board to 9.
-        }
+        seed = seeds();
     }
+    seedSet = false;
+    GameRandom gen(seed, randomStream, randomEngine); // Every random choice below comes from the seed.
+    unpacked.resize(size * size);
+    generateBoard(size, current_difficulty, gen, unpacked.data());
+    resetBoard();
+    loadBoard(unpacked.data());
 
-    std::random_device rd;  // Obtain a random number from hardware
-    std::mt19937 gen(rd()); // Seed the generator
+    num_moves = 0;
+    resetHistory(); // Clear history at the start of new game, the generated board is the first checkpoint.
 
-    // Define the range for the random numbers
-    std::uniform_int_distribution<> distrib(0, MAX_SIZE - 1); // Define the range [0,2] for rows and cols in uniform distribution.
-    for (int i = 0; i < current_difficulty; ++i)
+    canHint = true; // At new game can hint.
+    canRedo = false;
+    canUndo = false;
+}
+
+void GameLogic::generateBoard(int size, int difficulty, GameRandom &random, int *board)
+{
+    // Split the difficulty into press counts of 1 and 2 on random cells. At least ceil(cells / 9) cells stay unpressed,
+    // otherwise pressing every cell the same extra number of times could cancel presses and give a shorter solution.
+    int cells = size * size;
+    int pressable = std::max(1, cells - (cells + 8) / 9);
+    int twos = std::max(0, difficulty - pressable);
+    int ones = difficulty - 2 * twos;
+
+    std::vector<int> order(cells);
+    for (int i = 0; i < cells; ++i)
+    {
+        order[i] = i;
+    }
+    std::vector<int> presses(cells, 0);
+    for (int i = 0; i < ones + twos; ++i)
     {
-        Move move = {distrib(gen), distrib(gen)};
-        reverseMove(move); // Decrement random rows and cols by one.
+        int pick = i + static_cast<int>(random.below(cells - i)); // Partial shuffle picks distinct random cells.
+        std::swap(order[i], order[pick]);
+        presses[order[i]] = i < twos ? 2 : 1;
     }
 
-    // Clear redo stack at the start of new game.
-    while (!undoHistory.isEmpty())
+    // Undo the presses on a won board: every cell loses its row and column totals, the pressed cell counted once.
+    std::vector<int> rowTotals(size, 0);
+    std::vector<int> colTotals(size, 0);
+    for (int i = 0; i < cells; ++i)
+    {
+        rowTotals[i / size] += presses[i];
+        colTotals[i % size] += presses[i];
+    }
+    for (int i = 0; i < cells; ++i)
     {
-        undoHistory.pop();
+        board[i] = 9 - (rowTotals[i / size] + colTotals[i % size] - presses[i]) % 9;
     }
+}
 
-    // Clear undo stack at the start of new game.
-    while (!historyMoves.isEmpty())
+void GameLogic::setSeed(uint64_t seed)
+{
+    this->seed = seed;
+    seedSet = true;
+}
+
+uint64_t GameLogic::getSeed() const
+{
+    return seed;
+}
+
+void GameLogic::setRandomStream(uint64_t stream, GameRandom::Engine engine)
+{
+    randomStream = stream;
+    randomEngine = engine;
+}
+
+// Start a game from a given board, e.g. a replayed log or a shared puzzle.
+void GameLogic::setBoard(const int *values, uint64_t seed)
+{
+    for (int i = 0; i < size * size; ++i)
     {
-        historyMoves.pop();
+        if (values[i] < 1 || values[i] > 9)
+        {
+            throw std::out_of_range("Cannot set board value " + std::to_string(values[i]));
+        }
     }
+    stopMoveLog();
+    loadBoard(values);
+    this->seed = seed;
+    seedSet = false;
+    num_moves = 0;
+    resetHistory();
 
-    canHint = true; // At new game can hint.
+    canHint = true;
     canRedo = false;
     canUndo = false;
+}
+
+// Resize the board and reset it to the won state.
+void GameLogic::setSize(int size)
+{
+    if (size < 1 || size > MAX_SIZE)
+    {
+        throw std::out_of_range("Cannot set the board size " + std::to_string(size));
+    }
+    stopMoveLog();
+    this->size = size;
+    resetBoard(); // Set all values of board to 9.
+    if (current_difficulty > size * size)
+    {
+        current_difficulty = size * size;
+    }
+
+    // Clear history, old moves do not fit the new board.
     num_moves = 0;
+    resetHistory();
+
+    canHint = false;
+    canRedo = false;
+    canUndo = false;
+}
+
+int GameLogic::getSize() const
+{
+    return size;
+}
+
+// Convert the board to a different storage, values are kept.
+void GameLogic::setStorage(Storage storage)
+{
+    if (storage == this->storage)
+    {
+        return;
+    }
+    unpacked.resize(static_cast<std::size_t>(size) * size);
+    copyBoard(unpacked.data());
+    board.clear();
+    board.shrink_to_fit(); // Release the old storage.
+    packed = PackedBoard();
+    tiled = TiledBoard();
+    lazy = LazyBoard();
+    this->storage = storage;
+    if (storage == Storage::Packed)
+    {
+        packed.assign(unpacked.data(), size);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        tiled.assign(unpacked.data(), size);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.assign(unpacked.data(), size);
+    }
+    else
+    {
+        board = unpacked;
+    }
+    unsolved = static_cast<int>(std::count_if(unpacked.begin(), unpacked.end(), [](int value)
+                                              { return value != 9; })); // Lazy storage does not keep it up to date.
+}
+
+GameLogic::Storage GameLogic::getStorage() const
+{
+    return storage;
 }
 
 // Setter function to set the difficulty.
 void GameLogic::setDifficulty(int difficulty)
 {
-    if (difficulty > MAX_SIZE * MAX_SIZE || difficulty <= 0)
+    if (difficulty > size * size || difficulty <= 0)
     {
         throw std::out_of_range("Cannot set the difficulty " + std::to_string(difficulty));
     }
@@ -198,10 +470,13 @@ void GameLogic::undoMove()
     }
     if (canUndo) // Check that canUndo is true.
     {
-        undoHistory.push(historyMoves.top()); // Push in redo stack.
-        reverseMove(historyMoves.pop());      // Decrement values in last move.
-        canRedo = true;                       // After undo user can redo.
-        canUndo = num_moves != 0;             // If number of moves is zero then it is not possible to undo anymore.
+        reverseMove(history.at(num_moves - 1)); // Decrement values in last move, it stays in history for redo.
+        if (moveLog)
+        {
+            moveLog->recordUndo();
+        }
+        canRedo = true;                         // After undo user can redo.
+        canUndo = num_moves != 0;               // If number of moves is zero then it is not possible to undo anymore.
     }
     else
     {
@@ -213,15 +488,19 @@ void GameLogic::undoMove()
 // Function to redo move.
 void GameLogic::redoMove()
 {
-    if (undoHistory.isEmpty()) // If redo stack is empty throw exception.
+    if (static_cast<std::size_t>(num_moves) >= history.size()) // If there are no undone moves throw exception.
     {
         canRedo = false;
         throw std::runtime_error("Cannot redo moves from empty stack.");
     }
     if (canRedo) // Check if possible to redo.
     {
-        redoMakeMove(undoHistory.pop());  // Call redo move function with last undo move.
-        canRedo = !undoHistory.isEmpty(); // If redo stack is empty set canRedo to false.
+        redoMakeMove(history.at(num_moves)); // Call redo move function with first undone move.
+        if (moveLog)
+        {
+            moveLog->recordRedo();
+        }
+        canRedo = static_cast<std::size_t>(num_moves) < history.size(); // If no undone moves are left set canRedo to false.
     }
     else
     {
@@ -230,6 +509,148 @@ void GameLogic::redoMove()
     }
 }
 
+// Jump to a position in history: restore the nearest checkpoint at or before it and apply the remaining moves at once.
+void GameLogic::seekTo(int moveIndex)
+{
+    if (moveIndex < 0 || static_cast<std::size_t>(moveIndex) > history.size())
+    {
+        throw std::out_of_range("Cannot seek to move " + std::to_string(moveIndex));
+    }
+    int distance = moveIndex > num_moves ? moveIndex - num_moves : num_moves - moveIndex;
+    int first = moveIndex / checkpointInterval * checkpointInterval; // Nearest checkpoint at or before moveIndex.
+    if (moveLog)
+    {
+        logSeek(moveIndex);
+    }
+    if (distance <= size || storage == Storage::Lazy) // A few moves cost less than rebuilding the board, lazy moves always do.
+    {
+        while (num_moves < moveIndex)
+        {
+            incrementBoard(history.at(num_moves++));
+        }
+        while (num_moves > moveIndex)
+        {
+            decrementBoard(history.at(--num_moves));
+        }
+    }
+    else if (distance < moveIndex - first) // Current board is closer than the checkpoint.
+    {
+        unpacked.resize(static_cast<std::size_t>(size) * size);
+        copyBoard(unpacked.data());
+        if (moveIndex > num_moves)
+        {
+            pressHistory(unpacked.data(), num_moves, moveIndex, false);
+        }
+        else
+        {
+            pressHistory(unpacked.data(), moveIndex, num_moves, true);
+        }
+        loadBoard(unpacked.data());
+    }
+    else
+    {
+        const unsigned char *checkpoint = checkpoints.data() + static_cast<std::size_t>(first / checkpointInterval) * size * size;
+        unpacked.resize(static_cast<std::size_t>(size) * size);
+        std::copy(checkpoint, checkpoint + size * size, unpacked.begin());
+        pressHistory(unpacked.data(), first, moveIndex, false);
+        loadBoard(unpacked.data());
+    }
+    num_moves = moveIndex;
+    canUndo = num_moves > 0;
+    canRedo = static_cast<std::size_t>(num_moves) < history.size();
+    canHint = !isSolved(); // A seek can land on the winning move, where there is nothing to hint.
+}
+
+// Play a list of moves as one batch, history is the same as after playing them one by one.
+void GameLogic::makeMoves(const Move *moves, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) // Check all moves before changing anything.
+    {
+        if (!isInside(moves[i]))
+        {
+            throw std::out_of_range("Cannot play move at row " + std::to_string(moves[i].row) + ", column " + std::to_string(moves[i].col));
+        }
+    }
+    if (count == 0)
+    {
+        return;
+    }
+    if (count > static_cast<std::size_t>(std::numeric_limits<int>::max() - num_moves))
+    {
+        throw std::out_of_range("Cannot play " + std::to_string(count) + " moves, number of moves would overflow");
+    }
+
+    // Moves that could be redone are replaced by the new moves, with their checkpoints.
+    history.truncate(num_moves);
+    checkpoints.resize(static_cast<std::size_t>(num_moves / checkpointInterval + 1) * size * size);
+    history.append(moves, count);
+    if (moveLog)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            moveLog->recordMove(moves[i].row, moves[i].col);
+        }
+    }
+
+    int last = num_moves + static_cast<int>(count);
+    if (static_cast<int>(count) <= size || storage == Storage::Lazy) // Lazy moves cost less than rebuilding the board.
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            incrementBoard(moves[i]);
+            ++num_moves;
+            saveCheckpoint();
+        }
+    }
+    else
+    {
+        // Apply the batch up to each checkpoint in one pass, so the cost is O(size*size) per checkpoint interval.
+        unpacked.resize(static_cast<std::size_t>(size) * size);
+        copyBoard(unpacked.data());
+        while (num_moves < last)
+        {
+            int next = std::min(last, (num_moves / checkpointInterval + 1) * checkpointInterval);
+            pressHistory(unpacked.data(), num_moves, next, false);
+            num_moves = next;
+            if (num_moves % checkpointInterval == 0 || num_moves == last)
+            {
+                loadBoard(unpacked.data());
+                saveCheckpoint();
+            }
+        }
+    }
+    canUndo = true;  // After moves player can undo.
+    canRedo = false; // After moves player cannot redo.
+}
+
+void GameLogic::makeMoves(const std::vector<Move> &moves)
+{
+    makeMoves(moves.data(), moves.size());
+}
+
+// Undo several moves at once, they stay in history for redo.
+void GameLogic::undoMoves(int count)
+{
+    if (count < 0 || count > num_moves)
+    {
+        throw std::runtime_error("Cannot undo " + std::to_string(count) + " moves with number of moves " + std::to_string(num_moves));
+    }
+    if (count == 0)
+    {
+        return;
+    }
+    if (!canUndo)
+    {
+        throw std::runtime_error("GameLogic::undoMoves() called when canUndo is false. Ensure that a move can be undone before calling this function.");
+    }
+    seekTo(num_moves - count);
+}
+
+int GameLogic::getHistorySize() const
+{
+    return static_cast<int>(history.size());
+}
+
 // Getter functions...
 int GameLogic::getNumMoves() const
 {
@@ -251,36 +672,705 @@ bool GameLogic::isCanHint() const
     return canHint;
 }
 
-// Function to hint. Returns a move.
+// Function to hint. Returns a move from the optimal solution.
 GameLogic::Move GameLogic::hintNextMove() const
 {
     if (!canHint) // Check if can hint.
     {
         throw std::runtime_error("Hinting is not allowed at this time. Please check the game state.");
     }
-    int minMoves = 100; // Theoretical maximum is 9*9=81.
-    Move bestMove = {-1, -1};
-    for (int i = 0; i < MAX_SIZE; ++i)
+    if (distanceTable && size == DistanceTable::SIZE)
+    {
+        int cells[DistanceTable::SIZE * DistanceTable::SIZE];
+        copyBoard(cells);
+        return tableMove(*distanceTable, cells);
+    }
+    if (hintCache && size >= MIN_CACHED_SIZE && !solutionValid)
+    {
+        Move move;
+        if (cachedHint(move) <= 0)
+        {
+            throw std::runtime_error("Cannot hint a move, the board is already solved or has no solution.");
+        }
+        return move;
+    }
+    if (solve() <= 0)
+    {
+        throw std::runtime_error("Cannot hint a move, the board is already solved or has no solution.");
+    }
+    return mostPressed(solution.data(), size);
+}
+
+GameLogic::BoardSnapshot GameLogic::snapshotBoard() const
+{
+    if (!canHint)
+    {
+        throw std::runtime_error("Hinting is not allowed at this time. Please check the game state.");
+    }
+    BoardSnapshot snapshot;
+    snapshot.size = size;
+    snapshot.values.resize(static_cast<std::size_t>(size) * size);
+    copyBoard(snapshot.values.data());
+    snapshot.distanceTable = distanceTable;
+    snapshot.hintCache = hintCache;
+    snapshot.hash = stateHash();
+    return snapshot;
+}
+
+GameLogic::Move GameLogic::hintMove(const BoardSnapshot &snapshot, Solver::Monitor *monitor)
+{
+    int size = snapshot.size;
+    if (snapshot.distanceTable && size == DistanceTable::SIZE)
+    {
+        return tableMove(*snapshot.distanceTable, snapshot.values.data());
+    }
+    HintCache *cache = size >= MIN_CACHED_SIZE ? snapshot.hintCache.get() : nullptr;
+    HintCache::Hint hint;
+    if (!cache || !cache->find(snapshot.hash, size, snapshot.values.data(), hint))
+    {
+        std::vector<int> presses(snapshot.values.size());
+        hint.distance = Solver::solve(snapshot.values.data(), size, presses.data(), monitor);
+        if (hint.distance == Solver::CANCELLED)
+        {
+            return {-1, -1};
+        }
+        if (hint.distance > 0)
+        {
+            Move move = mostPressed(presses.data(), size);
+            hint.row = move.row;
+            hint.col = move.col;
+        }
+        if (cache)
+        {
+            cache->insert(snapshot.hash, size, snapshot.values.data(), hint);
+        }
+    }
+    if (hint.distance <= 0)
+    {
+        throw std::runtime_error("Cannot hint a move, the board is already solved or has no solution.");
+    }
+    return {hint.row, hint.col};
+}
+
+// Function to get number of moves left in optimal solution.
+int GameLogic::getOptimalDistance() const
+{
+    if (distanceTable && size == DistanceTable::SIZE)
+    {
+        int cells[DistanceTable::SIZE * DistanceTable::SIZE];
+        copyBoard(cells);
+        return distanceTable->distance(cells);
+    }
+    if (hintCache && size >= MIN_CACHED_SIZE && !solutionValid)
+    {
+        Move move;
+        return cachedHint(move);
+    }
+    return solve();
+}
+
+// Press counts of the optimal solution for every cell.
+std::vector<int> GameLogic::scoreCells() const
+{
+    if (solve() < 0)
+    {
+        throw std::runtime_error("Cannot score cells, the board has no solution.");
+    }
+    return solution;
+}
+
+bool GameLogic::saveSnapshot(const std::string &path) const
+{
+    static_assert(sizeof(Move) == 8, "Moves are stored as two 32-bit integers");
+    SnapshotHeader header = {};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.size = static_cast<uint32_t>(size);
+    header.difficulty = static_cast<uint32_t>(current_difficulty);
+    header.numMoves = static_cast<uint32_t>(num_moves);
+    header.historySize = static_cast<uint32_t>(history.size());
+    header.checkpointInterval = static_cast<uint32_t>(checkpointInterval);
+    header.flags = (canHint ? static_cast<uint32_t>(SNAPSHOT_CAN_HINT) : 0u) | (canUndo ? static_cast<uint32_t>(SNAPSHOT_CAN_UNDO) : 0u) |
+                   (canRedo ? static_cast<uint32_t>(SNAPSHOT_CAN_REDO) : 0u) |
+                   (storage == Storage::Packed ? static_cast<uint32_t>(SNAPSHOT_PACKED) : 0u) |
+                   (storage == Storage::Tiled ? static_cast<uint32_t>(SNAPSHOT_TILED) : 0u) |
+                   (storage == Storage::Lazy ? static_cast<uint32_t>(SNAPSHOT_LAZY) : 0u);
+    header.seed = seed;
+    header.checkpointBytes = checkpoints.size();
+
+    std::size_t historyOffset = sizeof(header) + boardBytes(header.size);
+    std::size_t checkpointOffset = historyOffset + history.size() * sizeof(Move);
+    std::string temporary = path + ".tmp";
+    MappedFile out;
+    if (!out.create(temporary, checkpointOffset + checkpoints.size()))
+    {
+        return false;
+    }
+    unsigned char *bytes = out.data();
+    std::memcpy(bytes, &header, sizeof(header));
+    unsigned char *cells = bytes + sizeof(header);
+    for (int row = 0; row < size; ++row)
     {
-        for (int j = 0; j < MAX_SIZE; ++j) // Iterate over board.
+        for (int col = 0; col < size; ++col)
         {
-            int currentMoves = 0;
+            cells[row * size + col] = static_cast<unsigned char>(getBoardValue({row, col}));
+        }
+    }
+    Move *moves = reinterpret_cast<Move *>(bytes + historyOffset);
+    for (std::size_t i = 0; i < history.size(); ++i)
+    {
+        moves[i] = history.at(i);
+    }
+    std::copy(checkpoints.begin(), checkpoints.end(), bytes + checkpointOffset);
+    bool flushed = out.flush(); // The data must be on the disk before the rename makes it visible.
+    out.close();
+    if (!flushed)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return MappedFile::replace(temporary, path);
+}
 
-            // Make move.
-            for (int k = 0; k < MAX_SIZE; ++k)
-                currentMoves += (board[i][k]);
-            for (int k = 0; k < MAX_SIZE; ++k)
-                currentMoves += (board[k][j]);
-            currentMoves -= (board[i][j]);
+bool GameLogic::loadSnapshot(const std::string &path)
+{
+    MappedFile in;
+    if (!in.open(path) || in.size() < sizeof(SnapshotHeader))
+    {
+        return false;
+    }
+    SnapshotHeader header;
+    std::memcpy(&header, in.data(), sizeof(header));
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.size < 1 || header.size > MAX_SIZE ||
+        header.difficulty < 1 || header.difficulty > header.size * header.size || header.numMoves > header.historySize ||
+        header.historySize > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+        header.checkpointInterval != static_cast<uint32_t>(std::max(64u, header.size * header.size)))
+    {
+        return false;
+    }
+    std::size_t cells = static_cast<std::size_t>(header.size) * header.size;
+    std::size_t historyOffset = sizeof(header) + boardBytes(header.size);
+    std::size_t checkpointOffset = historyOffset + static_cast<std::size_t>(header.historySize) * sizeof(Move);
+    std::size_t checkpointCount = header.historySize / header.checkpointInterval + 1;
+    if (in.size() != checkpointOffset + header.checkpointBytes || header.checkpointBytes != checkpointCount * cells)
+    {
+        return false;
+    }
+    const unsigned char *bytes = in.data();
+    const Move *moves = reinterpret_cast<const Move *>(bytes + historyOffset);
+    for (std::size_t i = 0; i < header.historySize; ++i) // Checked before anything is changed.
+    {
+        if (moves[i].row < 0 || moves[i].col < 0 || moves[i].row >= static_cast<int>(header.size) || moves[i].col >= static_cast<int>(header.size))
+        {
+            return false;
+        }
+    }
+    const unsigned char *board = bytes + sizeof(header);
+    for (std::size_t i = 0; i < cells; ++i)
+    {
+        if (board[i] < 1 || board[i] > 9)
+        {
+            return false;
+        }
+    }
+    // Checkpoints are rebuilt from the board and the history, a damaged checkpoint would show a wrong board after seekTo().
+    std::vector<int> values(board, board + cells);
+    pressMoves(values, static_cast<int>(header.size), moves, header.numMoves, true); // Board at the start of the history.
+    const unsigned char *checkpoint = bytes + checkpointOffset;
+    for (std::size_t k = 0; k < checkpointCount; ++k, checkpoint += cells)
+    {
+        if (k > 0)
+        {
+            pressMoves(values, static_cast<int>(header.size), moves + (k - 1) * header.checkpointInterval, header.checkpointInterval, false);
+        }
+        if (!std::equal(values.begin(), values.end(), checkpoint))
+        {
+            return false;
+        }
+    }
 
-            // Check if this iteration is better than the last one.
-            if (currentMoves < minMoves)
+    stopMoveLog();
+    setStorage(Storage::Dense);
+    size = static_cast<int>(header.size);
+    resetBoard();
+    unpacked.assign(board, board + cells);
+    loadBoard(unpacked.data());
+    if (header.flags & SNAPSHOT_PACKED)
+    {
+        setStorage(Storage::Packed);
+    }
+    else if (header.flags & SNAPSHOT_TILED)
+    {
+        setStorage(Storage::Tiled);
+    }
+    else if (header.flags & SNAPSHOT_LAZY)
+    {
+        setStorage(Storage::Lazy);
+    }
+    current_difficulty = static_cast<int>(header.difficulty);
+    num_moves = static_cast<int>(header.numMoves);
+    seed = header.seed;
+    seedSet = false;
+    checkpointInterval = static_cast<int>(header.checkpointInterval);
+    history.clear();
+    history.append(moves, header.historySize);
+    checkpoints.assign(bytes + checkpointOffset, bytes + checkpointOffset + header.checkpointBytes);
+    canHint = (header.flags & SNAPSHOT_CAN_HINT) != 0;
+    canUndo = (header.flags & SNAPSHOT_CAN_UNDO) != 0;
+    canRedo = (header.flags & SNAPSHOT_CAN_REDO) != 0;
+    return true;
+}
+
+bool GameLogic::startMoveLog(const std::string &path, bool keepHistory)
+{
+    stopMoveLog();
+    unpacked.resize(static_cast<std::size_t>(size) * size);
+    copyBoard(unpacked.data());
+    if (keepHistory)
+    {
+        pressHistory(unpacked.data(), 0, num_moves, true); // Board before the first move.
+    }
+    std::unique_ptr<MoveLogWriter> log(new MoveLogWriter());
+    if (!log->open(path, size, seed, unpacked.data()))
+    {
+        return false;
+    }
+    moveLog = std::move(log);
+    if (keepHistory)
+    {
+        for (std::size_t i = 0; i < history.size(); ++i)
+        {
+            moveLog->recordMove(history.at(i).row, history.at(i).col);
+        }
+        int current = num_moves;
+        num_moves = static_cast<int>(history.size()); // Where the log is after the moves.
+        logSeek(current);
+        num_moves = current;
+        return true;
+    }
+    // Moves before the log cannot be undone, the log starts a new history.
+    num_moves = 0;
+    resetHistory();
+    canUndo = false;
+    canRedo = false;
+    return true;
+}
+
+bool GameLogic::resumeMoveLog(const std::string &path)
+{
+    if (moveLog)
+    {
+        moveLog->flush(); // The log may be the one being recorded.
+    }
+    try
+    {
+        MoveLogReader reader(path);
+        if (reader.getSize() != size || reader.getSeed() != seed)
+        {
+            return false;
+        }
+        GameLogic replayed(size);
+        reader.replay(replayed);
+        if (replayed.getNumMoves() != num_moves || replayed.getHistorySize() != getHistorySize())
+        {
+            return false;
+        }
+        for (int i = 0; i < size; ++i)
+        {
+            for (int j = 0; j < size; ++j)
             {
-                minMoves = currentMoves;
-                bestMove = {i, j};
+                if (replayed.getBoardValue({i, j}) != getBoardValue({i, j}))
+                {
+                    return false;
+                }
             }
         }
     }
+    catch (const std::exception &)
+    {
+        return false; // Missing, damaged or undoing moves it never played.
+    }
+    stopMoveLog();
+    std::unique_ptr<MoveLogWriter> log(new MoveLogWriter());
+    if (!log->append(path))
+    {
+        return false;
+    }
+    moveLog = std::move(log);
+    return true;
+}
+
+void GameLogic::stopMoveLog()
+{
+    if (moveLog)
+    {
+        moveLog->close();
+        moveLog.reset();
+    }
+}
+
+void GameLogic::setDistanceTable(std::shared_ptr<const DistanceTable> table)
+{
+    distanceTable = std::move(table);
+}
+
+void GameLogic::setHintCache(std::shared_ptr<HintCache> cache)
+{
+    hintCache = std::move(cache);
+}
+
+bool GameLogic::isInside(Move move) const
+{
+    return move.row >= 0 && move.col >= 0 && move.row < size && move.col < size;
+}
+
+int GameLogic::solve() const
+{
+    if (solutionValid)
+    {
+        return solutionDistance; // Board did not change since the last solve.
+    }
+    std::size_t cells = static_cast<std::size_t>(size) * size;
+    solution.resize(cells);
+    lineSums.resize(2 * static_cast<std::size_t>(size));
+    for (int i = 0; i < size; ++i)
+    {
+        lineSums[i] = (rowDeficits[i] + 9 - lineShift) % 9;
+        lineSums[size + i] = (colDeficits[i] + 9 - lineShift) % 9;
+    }
+    const int *values = board.data();
+    if (storage != Storage::Dense)
+    {
+        unpacked.resize(cells);
+        copyBoard(unpacked.data()); // Solver works on one int per cell.
+        values = unpacked.data();
+    }
+    solutionDistance = Solver::solve(values, size, solution.data(), lineSums.data(), lineSums.data() + size);
+    solutionValid = true;
+    return solutionDistance;
+}
+
+int GameLogic::cachedHint(Move &move) const
+{
+    const int *values = board.data();
+    if (storage != Storage::Dense)
+    {
+        unpacked.resize(static_cast<std::size_t>(size) * size);
+        copyBoard(unpacked.data());
+        values = unpacked.data();
+    }
+    uint64_t key = stateHash();
+    HintCache::Hint hint;
+    if (!hintCache->find(key, size, values, hint))
+    {
+        hint.distance = solve(); // Copies the same values to unpacked again, values stays valid.
+        if (hint.distance > 0)
+        {
+            move = mostPressed(solution.data(), size);
+            hint.row = move.row;
+            hint.col = move.col;
+        }
+        hintCache->insert(key, size, values, hint);
+    }
+    move = {hint.row, hint.col};
+    return hint.distance;
+}
+
+void GameLogic::incrementBoard(Move move)
+{
+    hashLines(move, false);
+    if (storage == Storage::Packed)
+    {
+        unsolved += packed.increment(move.row, move.col);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        unsolved += tiled.increment(move.row, move.col);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.increment(move.row, move.col); // Unsolved cells are not counted, isWin() uses the line sums.
+    }
+    else
+    {
+        int *cells = board.data();
+        unsolved += visitBoardKernel(size, [cells, move](auto kernel)
+                                     { return kernel.increment(cells, move.row, move.col); });
+    }
+    shiftLines(move, false);
+}
+
+void GameLogic::decrementBoard(Move move)
+{
+    hashLines(move, true);
+    if (storage == Storage::Packed)
+    {
+        unsolved += packed.decrement(move.row, move.col);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        unsolved += tiled.decrement(move.row, move.col);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.decrement(move.row, move.col);
+    }
+    else
+    {
+        int *cells = board.data();
+        unsolved += visitBoardKernel(size, [cells, move](auto kernel)
+                                     { return kernel.decrement(cells, move.row, move.col); });
+    }
+    shiftLines(move, true);
+}
+
+void GameLogic::resetBoard()
+{
+    if (storage == Storage::Packed)
+    {
+        packed.reset(size);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        tiled.reset(size);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.reset(size);
+    }
+    else
+    {
+        board.assign(static_cast<std::size_t>(size) * size, 9);
+    }
+    unsolved = 0;
+    rowDeficits.assign(size, 0); // A won board has no deficits.
+    colDeficits.assign(size, 0);
+    rowDeficitCounts.assign(9, 0);
+    colDeficitCounts.assign(9, 0);
+    rowDeficitCounts[0] = size;
+    colDeficitCounts[0] = size;
+    lineShift = 0;
+    solutionValid = false;
+    hashValid = false;
+}
+
+void GameLogic::resetHistory()
+{
+    history.clear();
+    checkpointInterval = std::max(64, size * size);
+    checkpoints.resize(static_cast<std::size_t>(size) * size);
+    checkpoints.shrink_to_fit(); // Release checkpoints of a previous game.
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            checkpoints[row * size + col] = static_cast<unsigned char>(getBoardValue({row, col}));
+        }
+    }
+}
+
+void GameLogic::saveCheckpoint()
+{
+    if (num_moves % checkpointInterval != 0)
+    {
+        return;
+    }
+    std::size_t offset = checkpoints.size();
+    checkpoints.resize(offset + static_cast<std::size_t>(size) * size);
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            checkpoints[offset + row * size + col] = static_cast<unsigned char>(getBoardValue({row, col}));
+        }
+    }
+}
+
+void GameLogic::logSeek(int moveIndex)
+{
+    int distance = moveIndex > num_moves ? moveIndex - num_moves : num_moves - moveIndex;
+    if (distance > MoveLogFormat::seekSlots(size))
+    {
+        moveLog->recordSeek(moveIndex); // One event, replayed with a single seekTo().
+        return;
+    }
+    for (int i = 0; i < distance; ++i)
+    {
+        moveIndex > num_moves ? moveLog->recordRedo() : moveLog->recordUndo();
+    }
+}
+
+// Moves commute, so a range of moves adds the press count of its row and column to every cell,
+// and the crossing cell of each move was counted twice.
+void GameLogic::pressHistory(int *values, int first, int last, bool reverse) const
+{
+    rowPresses.assign(size, 0);
+    colPresses.assign(size, 0);
+    int step = reverse ? 8 : 1; // Undoing a press adds 8, i.e. -1 modulo 9.
+    for (int i = first; i < last; ++i)
+    {
+        Move move = history.at(i);
+        ++rowPresses[move.row];
+        ++colPresses[move.col];
+        values[move.row * size + move.col] += 9 - step; // Crossing cell gets one step less.
+    }
+    for (int i = 0; i < size; ++i)
+    {
+        rowPresses[i] = rowPresses[i] % 9 * step;
+        colPresses[i] = colPresses[i] % 9 * step;
+    }
+    for (int row = 0; row < size; ++row)
+    {
+        int *line = values + row * size;
+        for (int col = 0; col < size; ++col)
+        {
+            line[col] = (line[col] - 1 + rowPresses[row] + colPresses[col]) % 9 + 1;
+        }
+    }
+}
+
+void GameLogic::loadBoard(const int *values)
+{
+    if (storage == Storage::Packed)
+    {
+        packed.assign(values, size);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        tiled.assign(values, size);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.assign(values, size);
+    }
+    else
+    {
+        std::copy(values, values + size * size, board.begin());
+    }
+    unsolved = static_cast<int>(std::count_if(values, values + size * size, [](int value)
+                                              { return value != 9; }));
+    countLines(values);
+    hashValid = false; // Rehashed when asked, loading already costs O(size*size).
+}
+
+void GameLogic::shiftLines(Move move, bool reverse)
+{
+    int along = (size - 1) % 9; // Row and column of the move lose size - 1 more than the other lines.
+    --rowDeficitCounts[rowDeficits[move.row]];
+    --colDeficitCounts[colDeficits[move.col]];
+    if (reverse)
+    {
+        rowDeficits[move.row] = (rowDeficits[move.row] + along) % 9;
+        colDeficits[move.col] = (colDeficits[move.col] + along) % 9;
+        lineShift = (lineShift + 8) % 9;
+    }
+    else
+    {
+        rowDeficits[move.row] = (rowDeficits[move.row] + 9 - along) % 9;
+        colDeficits[move.col] = (colDeficits[move.col] + 9 - along) % 9;
+        lineShift = (lineShift + 1) % 9;
+    }
+    ++rowDeficitCounts[rowDeficits[move.row]];
+    ++colDeficitCounts[colDeficits[move.col]];
+    solutionValid = false;
+}
+
+void GameLogic::hashLines(Move move, bool reverse)
+{
+    if (!hashValid)
+    {
+        return; // Nobody asked for the hash since the board was loaded.
+    }
+    if (storage == Storage::Packed)
+    {
+        hash ^= hashChange(size, move, reverse, [this](int row, int col)
+                           { return packed.value(row, col); });
+    }
+    else if (storage == Storage::Tiled)
+    {
+        hash ^= hashChange(size, move, reverse, [this](int row, int col)
+                           { return tiled.value(row, col); });
+    }
+    else if (storage == Storage::Lazy)
+    {
+        hashValid = false; // Reading a row and a column would make lazy moves O(size).
+    }
+    else
+    {
+        const int *cells = board.data();
+        int size = this->size;
+        hash ^= hashChange(size, move, reverse, [cells, size](int row, int col)
+                           { return cells[row * size + col]; });
+    }
+}
+
+void GameLogic::countLines(const int *values)
+{
+    rowDeficits.assign(size, 0);
+    colDeficits.assign(size, 0);
+    for (int row = 0; row < size; ++row)
+    {
+        const int *line = values + row * size;
+        for (int col = 0; col < size; ++col)
+        {
+            int deficit = 9 - line[col]; // Value 9 has deficit 0.
+            rowDeficits[row] += deficit;
+            colDeficits[col] += deficit;
+        }
+    }
+    rowDeficitCounts.assign(9, 0);
+    colDeficitCounts.assign(9, 0);
+    for (int i = 0; i < size; ++i)
+    {
+        rowDeficits[i] %= 9;
+        colDeficits[i] %= 9;
+        ++rowDeficitCounts[rowDeficits[i]];
+        ++colDeficitCounts[colDeficits[i]];
+    }
+    lineShift = 0;
+    solutionValid = false;
+}
 
-    return bestMove;
-}
\ No newline at end of file
+bool GameLogic::isSolved() const
+{
+    if (storage == Storage::Lazy)
+    {
+        // A line with a deficit sum other than 0 has a value other than 9, so the board is rarely read before a win.
+        return rowDeficitCounts[lineShift] == size && colDeficitCounts[lineShift] == size && lazy.isSolved();
+    }
+    assert(unsolved == countUnsolved()); // Debug builds check the running count against the board.
+    return unsolved == 0;
+}
+
+int GameLogic::countUnsolved() const
+{
+    int count = 0;
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            count += getBoardValue({row, col}) != 9;
+        }
+    }
+    return count;
+}
+
+void GameLogic::copyBoard(int *cells) const
+{
+    if (storage == Storage::Packed)
+    {
+        packed.copyTo(cells);
+    }
+    else if (storage == Storage::Tiled)
+    {
+        tiled.copyTo(cells);
+    }
+    else if (storage == Storage::Lazy)
+    {
+        lazy.copyTo(cells);
+    }
+    else
+    {
+        std::copy(board.begin(), board.end(), cells);
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file gamerandom.cpp
+ * @brief Implementation of GameRandom class methods.
+ *
+ * xoshiro256** by Blackman and Vigna, its state is filled by SplitMix64.
+ * Philox4x32-10 by Salmon et al. (Random123), the 128-bit counter is made
+ * of the block index and the stream, the 64-bit key is the seed.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "gamerandom.hpp"
+
+namespace
+{
+    constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+    constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+    constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+    constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+    constexpr int PHILOX_ROUNDS = 10;
+
+    inline uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    inline uint64_t splitMix(uint64_t &x)
+    {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+GameRandom::GameRandom(uint64_t seed, uint64_t stream, Engine engine) : engine(engine)
+{
+    this->seed(seed, stream);
+}
+
+void GameRandom::seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t x = seed ^ rotl(stream * 0xD1B54A32D192ED03ULL, 32); // Stream 0 keeps the plain seed.
+    for (uint64_t &word : state)
+    {
+        word = splitMix(x); // Never all zero.
+    }
+    key = seed;
+    this->stream = stream;
+    counter = 0;
+    used = 2;
+}
+
+GameRandom::Engine GameRandom::getEngine() const
+{
+    return engine;
+}
+
+GameRandom::result_type GameRandom::operator()()
+{
+    if (engine == Engine::Philox)
+    {
+        if (used == 2)
+        {
+            nextBlock();
+        }
+        return block[used++];
+    }
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+uint64_t GameRandom::below(uint64_t bound)
+{
+    uint64_t threshold = (0 - bound) % bound; // 2^64 modulo bound, values below it would be more likely.
+    for (;;)
+    {
+        uint64_t value = (*this)();
+        if (value >= threshold)
+        {
+            return value % bound;
+        }
+    }
+}
+
+void GameRandom::nextBlock()
+{
+    uint32_t c[4] = {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+                     static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    uint32_t k[2] = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c[0];
+        uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c[2];
+        uint32_t next[4] = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k[0], static_cast<uint32_t>(p1),
+                            static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k[1], static_cast<uint32_t>(p0)};
+        c[0] = next[0];
+        c[1] = next[1];
+        c[2] = next[2];
+        c[3] = next[3];
+        k[0] += PHILOX_W0;
+        k[1] += PHILOX_W1;
+    }
+    block[0] = (static_cast<uint64_t>(c[1]) << 32) | c[0];
+    block[1] = (static_cast<uint64_t>(c[3]) << 32) | c[2];
+    ++counter;
+    used = 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file gameserver.cpp
+ * @brief Implementation of GameServer class methods.
+ *
+ * A worker takes its whole queue at once, so a busy worker locks once per
+ * batch of requests and not once per request. Taking the queue also makes
+ * room for submit() calls waiting on a full queue.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "gameserver.hpp"
+
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+GameServer::GameServer(int workers, std::size_t hintCacheBytes) : GameServer(workers, hintCacheBytes, Limits())
+{
+}
+
+GameServer::GameServer(int workers, std::size_t hintCacheBytes, const Limits &limits)
+    : lastSession(0), sessions(0), cells(0), limits(limits)
+{
+    if (hintCacheBytes > 0)
+    {
+        hintCache = std::make_shared<HintCache>(hintCacheBytes);
+    }
+    if (workers < 1)
+    {
+        workers = 1;
+    }
+    for (int i = 0; i < workers; ++i)
+    {
+        this->workers.push_back(std::make_unique<Worker>());
+    }
+    for (auto &worker : this->workers)
+    {
+        Worker *self = worker.get();
+        worker->thread = std::thread([this, self]
+                                     { work(*self); });
+    }
+}
+
+GameServer::~GameServer()
+{
+    for (auto &worker : workers)
+    {
+        {
+            std::lock_guard<std::mutex> guard(worker->lock);
+            worker->stopping = true;
+        }
+        worker->wake.notify_one();
+    }
+    for (auto &worker : workers)
+    {
+        worker->thread.join();
+    }
+}
+
+void GameServer::reserve(std::size_t cells)
+{
+    // Count first and undo when over, so concurrent workers never pass a limit together.
+    if (++sessions > limits.maxSessions && limits.maxSessions > 0)
+    {
+        --sessions;
+        throw std::length_error("Too many sessions, the limit is " + std::to_string(limits.maxSessions));
+    }
+    if ((this->cells += cells) > limits.maxCells && limits.maxCells > 0)
+    {
+        this->cells -= cells;
+        --sessions;
+        throw std::length_error("Too many cells in open sessions, the limit is " + std::to_string(limits.maxCells));
+    }
+}
+
+GameServer::Worker &GameServer::owner(uint64_t session) const
+{
+    return *workers[session % workers.size()];
+}
+
+void GameServer::submit(const Request &request, Reply reply)
+{
+    Request queued = request;
+    if (queued.command == Command::New)
+    {
+        queued.session = ++lastSession; // The id decides the worker, so it is given out before queueing.
+    }
+    Worker &worker = owner(queued.session);
+    {
+        std::unique_lock<std::mutex> guard(worker.lock);
+        if (limits.maxQueue > 0)
+        {
+            worker.room.wait(guard, [this, &worker]
+                             { return worker.queue.size() < limits.maxQueue; });
+        }
+        worker.queue.emplace_back(queued, std::move(reply));
+    }
+    worker.wake.notify_one();
+}
+
+GameServer::Response GameServer::execute(const Request &request)
+{
+    Request queued = request;
+    if (queued.command == Command::New)
+    {
+        queued.session = ++lastSession;
+    }
+    return run(owner(queued.session), queued);
+}
+
+std::size_t GameServer::getSessionCount() const
+{
+    return sessions;
+}
+
+std::size_t GameServer::getCellCount() const
+{
+    return cells;
+}
+
+const GameServer::Limits &GameServer::getLimits() const
+{
+    return limits;
+}
+
+int GameServer::getWorkerCount() const
+{
+    return static_cast<int>(workers.size());
+}
+
+HintCache::Stats GameServer::getHintCacheStats() const
+{
+    return hintCache ? hintCache->getStats() : HintCache::Stats();
+}
+
+void GameServer::work(Worker &worker)
+{
+    std::deque<std::pair<Request, Reply>> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(worker.lock);
+            worker.wake.wait(guard, [&worker]
+                             { return worker.stopping || !worker.queue.empty(); });
+            if (worker.queue.empty())
+            {
+                return; // Stopping and every request was answered.
+            }
+            batch.swap(worker.queue);
+        }
+        worker.room.notify_all();
+        for (auto &item : batch)
+        {
+            Response response = run(worker, item.first);
+            if (item.second)
+            {
+                item.second(response);
+            }
+        }
+        batch.clear();
+    }
+}
+
+GameServer::Response GameServer::run(Worker &worker, const Request &request)
+{
+    Response response;
+    response.command = request.command;
+    response.tag = request.tag;
+    response.session = request.session;
+    try
+    {
+        GameLogic *game = nullptr;
+        if (request.command == Command::New)
+        {
+            if (limits.maxSize > 0 && request.size > limits.maxSize)
+            {
+                throw std::length_error("Board size " + std::to_string(request.size) + " is over the limit of " +
+                                        std::to_string(limits.maxSize));
+            }
+            std::size_t area = request.size > 0 ? static_cast<std::size_t>(request.size) * request.size : 0;
+            reserve(area); // Before building the board, so requests over the limits cost nothing.
+            try
+            {
+                auto created = std::make_unique<GameLogic>(request.size);
+                created->setDifficulty(request.difficulty);
+                created->setHintCache(hintCache);
+                if (request.seeded)
+                {
+                    created->setSeed(request.seed);
+                }
+                created->init();
+                game = created.get();
+                worker.sessions.emplace(request.session, std::move(created));
+            }
+            catch (...)
+            {
+                cells -= area;
+                --sessions;
+                throw;
+            }
+        }
+        else
+        {
+            auto found = worker.sessions.find(request.session);
+            if (found == worker.sessions.end())
+            {
+                throw std::invalid_argument("Unknown session " + std::to_string(request.session));
+            }
+            game = found->second.get();
+        }
+
+        switch (request.command)
+        {
+        case Command::Move:
+            if (limits.maxHistory > 0 && static_cast<std::size_t>(game->getNumMoves()) >= limits.maxHistory)
+            {
+                throw std::length_error("Too many moves in the session, the limit is " + std::to_string(limits.maxHistory));
+            }
+            game->makeMove({request.row, request.col});
+            break;
+        case Command::Undo:
+            game->undoMove();
+            break;
+        case Command::Redo:
+            game->redoMove();
+            break;
+        case Command::Hint:
+        {
+            GameLogic::Move move = game->hintNextMove();
+            response.row = move.row;
+            response.col = move.col;
+            break;
+        }
+        case Command::Close:
+            cells -= static_cast<std::size_t>(game->getSize()) * game->getSize();
+            worker.sessions.erase(request.session);
+            --sessions;
+            return response;
+        default:
+            break;
+        }
+
+        response.moves = game->getNumMoves();
+        response.won = game->isWin();
+        if (request.command == Command::New || request.command == Command::State)
+        {
+            int size = game->getSize();
+            response.size = size;
+            response.seed = game->getSeed();
+            response.board.resize(static_cast<std::size_t>(size) * size);
+            for (int i = 0; i < size; ++i)
+            {
+                for (int j = 0; j < size; ++j)
+                {
+                    response.board[i * size + j] = static_cast<unsigned char>(game->getBoardValue({i, j}));
+                }
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        response.ok = false;
+        response.error = e.what();
+        if (request.command == Command::New)
+        {
+            response.session = 0; // The session was not created.
+        }
+    }
+    return response;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file hintcache.cpp
+ * @brief Implementation of HintCache class methods.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "hintcache.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+    // Bytes of an entry besides its packed board: the list node and the hash map node and bucket.
+    constexpr std::size_t NODE_BYTES = 6 * sizeof(void *);
+}
+
+HintCache::HintCache(std::size_t budget, int shards) : budget(budget), hits(0), misses(0), evictions(0)
+{
+    if (shards < 1)
+    {
+        throw std::invalid_argument("Cannot create hint cache with " + std::to_string(shards) + " shards");
+    }
+    this->shards = std::vector<Shard>(static_cast<std::size_t>(shards));
+}
+
+bool HintCache::find(uint64_t key, int size, const int *values, Hint &hint)
+{
+    std::string board = packBoard(size, values);
+    Shard &shard = shardOf(key);
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        auto found = shard.index.find(key);
+        if (found != shard.index.end() && found->second->board == board) // Equal keys of other boards are misses.
+        {
+            shard.order.splice(shard.order.begin(), shard.order, found->second);
+            hint = found->second->hint;
+            ++hits;
+            return true;
+        }
+    }
+    ++misses;
+    return false;
+}
+
+void HintCache::insert(uint64_t key, int size, const int *values, const Hint &hint)
+{
+    std::size_t limit = budget / shards.size();
+    std::size_t bytes = entryBytes(size);
+    if (bytes > limit)
+    {
+        return;
+    }
+    std::string board = packBoard(size, values);
+    Shard &shard = shardOf(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto found = shard.index.find(key);
+    if (found != shard.index.end())
+    {
+        shard.bytes -= found->second->bytes;
+        shard.order.erase(found->second);
+        shard.index.erase(found);
+    }
+    shard.order.push_front(Entry{key, std::move(board), hint, bytes});
+    shard.index.emplace(key, shard.order.begin());
+    shard.bytes += bytes;
+    evict(shard, limit);
+}
+
+void HintCache::setBudget(std::size_t budget)
+{
+    this->budget = budget;
+    std::size_t limit = budget / shards.size();
+    for (Shard &shard : shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        evict(shard, limit);
+    }
+}
+
+std::size_t HintCache::getBudget() const
+{
+    return budget;
+}
+
+void HintCache::clear()
+{
+    for (Shard &shard : shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.order.clear();
+        shard.index.clear();
+        shard.bytes = 0;
+    }
+}
+
+HintCache::Stats HintCache::getStats() const
+{
+    Stats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.evictions = evictions;
+    for (const Shard &shard : shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        stats.entries += shard.index.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
+
+std::size_t HintCache::entryBytes(int size)
+{
+    std::size_t cells = static_cast<std::size_t>(size) * size;
+    return sizeof(Entry) + NODE_BYTES + 2 + (cells + 1) / 2;
+}
+
+std::string HintCache::packBoard(int size, const int *values)
+{
+    std::size_t cells = static_cast<std::size_t>(size) * size;
+    std::string board(2 + (cells + 1) / 2, '\0');
+    board[0] = static_cast<char>(size & 0xFF); // MAX_SIZE fits in two bytes.
+    board[1] = static_cast<char>(size >> 8);
+    for (std::size_t cell = 0; cell < cells; ++cell)
+    {
+        board[2 + cell / 2] |= static_cast<char>(values[cell] << (cell % 2 * 4));
+    }
+    return board;
+}
+
+void HintCache::evict(Shard &shard, std::size_t limit)
+{
+    while (shard.bytes > limit && !shard.order.empty())
+    {
+        const Entry &last = shard.order.back();
+        shard.bytes -= last.bytes;
+        shard.index.erase(last.key);
+        shard.order.pop_back();
+        ++evictions;
+    }
+}
+
+HintCache::Shard &HintCache::shardOf(uint64_t key)
+{
+    return shards[(key >> 32) % shards.size()]; // High bits, the low bits pick the hash map bucket.
+}
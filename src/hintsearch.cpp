@@ -0,0 +1,119 @@
+/**
+ * @file hintsearch.cpp
+ * @brief Implementation of HintSearch class methods.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "hintsearch.hpp"
+
+#include <exception>
+#include <utility>
+
+HintSearch::HintSearch(Progress progress, Done done)
+    : progress(std::move(progress)), done(std::move(done)), running(nullptr), lastId(0), current(0), stopping(false)
+{
+    worker = std::thread([this]
+                         { work(); });
+}
+
+HintSearch::~HintSearch()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+        pending.reset();
+        if (running)
+        {
+            running->cancelled = true;
+        }
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+uint64_t HintSearch::start(GameLogic::BoardSnapshot snapshot)
+{
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        id = ++lastId;
+        current = id;
+        pending.reset(new Job{id, std::move(snapshot)});
+        if (running)
+        {
+            running->cancelled = true; // Only the newest board matters.
+        }
+    }
+    wake.notify_one();
+    return id;
+}
+
+void HintSearch::cancel()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    current = 0;
+    pending.reset();
+    if (running)
+    {
+        running->cancelled = true;
+    }
+}
+
+bool HintSearch::isCurrent(uint64_t search) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return search != 0 && search == current;
+}
+
+bool HintSearch::isBusy() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return pending || running;
+}
+
+void HintSearch::work()
+{
+    while (true)
+    {
+        std::unique_ptr<Job> job;
+        Solver::Monitor monitor;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this]
+                      { return stopping || pending; });
+            if (stopping)
+            {
+                return;
+            }
+            job = std::move(pending);
+            uint64_t id = job->id;
+            if (progress)
+            {
+                monitor.progress = [this, id](int percent)
+                { progress(id, percent); };
+            }
+            running = &monitor;
+        }
+
+        GameLogic::Move move = {-1, -1};
+        try
+        {
+            move = GameLogic::hintMove(job->snapshot, &monitor);
+        }
+        catch (const std::exception &)
+        {
+            // Solved or unsolvable board, reported as no move.
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            running = nullptr;
+        }
+        if (!monitor.cancelled && done)
+        {
+            done(job->id, move);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file lazyboard.cpp
+ * @brief Implementation of LazyBoard class methods.
+ *
+ * Only loading and reading the whole board touch every cell, moves are
+ * inline in the header.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "lazyboard.hpp"
+
+LazyBoard::LazyBoard() : size(0) {}
+
+void LazyBoard::reset(int size)
+{
+    this->size = size;
+    cells.assign(static_cast<std::size_t>(size) * size, 8); // Value 9 with no presses.
+    rows.assign(size, 0);
+    cols.assign(size, 0);
+}
+
+void LazyBoard::assign(const int *values, int size)
+{
+    reset(size);
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        cells[i] = static_cast<unsigned char>(values[i] - 1);
+    }
+}
+
+void LazyBoard::copyTo(int *values) const
+{
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            values[row * size + col] = value(row, col);
+        }
+    }
+}
+
+bool LazyBoard::isSolved() const
+{
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            if (value(row, col) != 9)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::size_t LazyBoard::bytes() const
+{
+    return cells.size() + rows.size() + cols.size();
+}
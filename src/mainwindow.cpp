@@ -8,53 +8,115 @@
 
 #include "mainwindow.hpp"
 #include "ui_mainwindow.h"
-#include "hoverbutton.hpp"
+#include "boardwidget.hpp"
+#include "distancetable.hpp"
+#include "hintcache.hpp"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QCloseEvent>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QInputDialog>
 #include <QMessageBox>
+#include <QProgressBar>
+#include <QSignalBlocker>
+#include <QStandardPaths>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent), ui(new Ui::MainWindow)
 {
     ui->setupUi(this); // Set up the ui.
 
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
-    {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        HoverButton *button = qobject_cast<HoverButton *>(item->widget());
-        if (button)
-        {
-            connect(button, &HoverButton::clicked, this, &MainWindow::playCell);
-            connect(button, &HoverButton::hovered, this, &MainWindow::hoverEffect);
-            connect(button, &HoverButton::unhovered, this, &MainWindow::unHoverEffect);
-        }
-    }
+    // Hints are searched on a worker thread, its callbacks are queued to the GUI thread so the window never waits.
+    hintProgress = new QProgressBar(this);
+    hintProgress->setRange(0, 100);
+    hintProgress->setMaximumWidth(160);
+    hintProgress->hide();
+    ui->statusbar->addPermanentWidget(hintProgress);
+    hintSearch = std::make_unique<HintSearch>(
+        [this](uint64_t search, int percent)
+        { QMetaObject::invokeMethod(this, [this, search, percent]
+                                    { showHintProgress(search, percent); }, Qt::QueuedConnection); },
+        [this](uint64_t search, GameLogic::Move move)
+        { QMetaObject::invokeMethod(this, [this, search, move]
+                                    { showHint(search, move); }, Qt::QueuedConnection); });
+
+    // The board widget paints every cell itself and reports clicks as moves.
+    ui->board->setGame(&game);
+    connect(ui->board, &BoardWidget::cellClicked, this, &MainWindow::playCell);
 
     // Connect the signal from difficulty slider value change to updateDifficultyLabel slot.
     connect(ui->slider_difficulty, &QSlider::valueChanged, this, &MainWindow::updateDifficultyLabel);
     connect(ui->slider_difficulty, &QSlider::sliderReleased, this, &MainWindow::updateDifficulty);
 
+    // Seeking is bounded by the board size, so the board follows the history slider while it is dragged.
+    connect(ui->slider_history, &QSlider::valueChanged, this, &MainWindow::seekHistory);
+
     connect(ui->actionExit, &QAction::triggered, this, &MainWindow::close);
     connect(ui->actionNew_Game, &QAction::triggered, this, &MainWindow::updateDifficulty);
+    connect(ui->actionNew_Game_from_Seed, &QAction::triggered, this, &MainWindow::newGameFromSeed);
+    connect(ui->actionBoard_Size, &QAction::triggered, this, &MainWindow::changeBoardSize);
 
     connect(ui->actionUndo, &QAction::triggered, this, &MainWindow::undoAction);
     connect(ui->actionRedo, &QAction::triggered, this, &MainWindow::redoAction);
     connect(ui->actionShow_Colors, &QAction::triggered, this, &MainWindow::colorsToggle);
     connect(ui->actionHint, &QAction::triggered, this, &MainWindow::hintAction);
     connect(ui->actionAbout, &QAction::triggered, this, [&]
-            { QMessageBox::information(this, "About Target 9", "A 'Target 9' game is set on a 3x3 grid of digits (integers). The game starts with an initial configuration of digits and the user's target is to change all of them to 9 in the minimum number of moves.\nHow to make a Move:\nIn order to make a move, the user selects a cell, and all the digits in the same row and column as the selected cell are increased by one\nVersion: 1.1.0\n"); });
+            { QMessageBox::information(this, "About Target 9", QString("A 'Target 9' game is set on a grid of digits (integers), 3x3 by default. The game starts with an initial configuration of digits and the user's target is to change all of them to 9 in the minimum number of moves.\nHow to make a Move:\nIn order to make a move, the user selects a cell, and all the digits in the same row and column as the selected cell are increased by one\nVersion: 1.1.0\nSeed of this board: %1 (File > New Game from Seed... plays it again)\n").arg(game.getSeed())); });
 
     show_colors = true;
 
+    // Hints on 3x3 boards come from the table generated by target9-table, if it is next to the executable.
+    // The file is only mapped when the first hint is requested.
+    game.setDistanceTable(std::make_shared<DistanceTable>(QCoreApplication::applicationDirPath().toStdString() + "/target9_3x3.tbl"));
+    // Hints of positions seen before, e.g. after undoing moves, are not searched again.
+    game.setHintCache(std::make_shared<HintCache>());
+
     // Set the default slider value to label.
     updateDifficultyLabel(ui->slider_difficulty->value());
 
-    game.init();
+    // Resume the last session if it was saved, otherwise start a new game.
+    if (game.loadSnapshot(snapshotPath().toStdString()))
+    {
+        ui->slider_difficulty->setValue(game.getDifficulty());
+        updateDifficultyLabel(game.getDifficulty());
+        if (game.isWin())
+        {
+            disable_all();
+        }
+        updateCells();
+        resumeSession();
+    }
+    else
+    {
+        game.init();
+        updateCells();
+        startSession();
+    }
+}
 
-    updateCells();
+void MainWindow::closeEvent(QCloseEvent *event)
+{
+    QDir().mkpath(QFileInfo(snapshotPath()).path());
+    game.saveSnapshot(snapshotPath().toStdString());
+    QMainWindow::closeEvent(event);
+}
+
+QString MainWindow::snapshotPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/session.t9s";
+}
+
+QString MainWindow::sessionsPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/sessions";
 }
 
 MainWindow::~MainWindow()
 {
-    delete ui; // Delete ui to prevent memory leak.
+    hintSearch.reset(); // Join the worker before the window it reports to goes away.
+    delete ui;          // Delete ui to prevent memory leak.
 }
 
 int MainWindow::showPopup(int level)
@@ -119,21 +181,19 @@ void MainWindow::updateDifficultyLabel(int value)
     ui->label_difficulty->setText(QString("Difficulty: %1").arg(value)); // Set text of label_difficulty.
 }
 
-void MainWindow::playCell()
+void MainWindow::playCell(GameLogic::Move move)
 {
     try
     {
-        QPushButton *button = qobject_cast<QPushButton *>(sender());
-        GameLogic::Move move = getButtonRowCol(button);
         game.makeMove(move);
-        updateCells();
-        hoverEffect();
+        updateCells(move);
         if (game.isWin())
         {
             if (showPopup(0))
             {
                 game.init();
                 updateCells();
+                startSession();
             }
             else
             {
@@ -148,44 +208,6 @@ void MainWindow::playCell()
     }
 }
 
-void MainWindow::hoverEffect()
-{
-    QPushButton *button = qobject_cast<QPushButton *>(sender());
-    GameLogic::Move selected = getButtonRowCol(button);
-
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
-    {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        QPushButton *button = qobject_cast<QPushButton *>(item->widget());
-        GameLogic::Move move = getButtonRowCol(button);
-
-        if (move.row == selected.row || move.col == selected.col)
-        {
-            button->setStyleSheet(button->styleSheet().append(QString("border: 5px solid red;")));
-            button->setStyleSheet(button->styleSheet().append(QString("padding: 5px;")));
-        }
-    }
-}
-
-void MainWindow::unHoverEffect()
-{
-    QPushButton *button = qobject_cast<QPushButton *>(sender());
-    GameLogic::Move selected = getButtonRowCol(button);
-
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
-    {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        QPushButton *button = qobject_cast<QPushButton *>(item->widget());
-        GameLogic::Move move = getButtonRowCol(button);
-
-        if (move.row == selected.row || move.col == selected.col)
-        {
-            button->setStyleSheet(button->styleSheet().remove(QString("border: 5px solid red;")));
-            button->setStyleSheet(button->styleSheet().remove(QString("padding: 5px;")));
-        }
-    }
-}
-
 void MainWindow::updateDifficulty()
 {
     try
@@ -206,6 +228,7 @@ void MainWindow::updateDifficulty()
                     game.init(); // Initialize the game
                     enable_all();
                     updateCells();
+                    startSession();
                 }
                 else
                 {
@@ -260,15 +283,16 @@ void MainWindow::redoAction()
 void MainWindow::colorsToggle()
 {
     show_colors = !show_colors;
-    updateCells();
+    ui->board->setColorsShown(show_colors);
 }
 
 void MainWindow::hintAction()
 {
     try
     {
-        GameLogic::Move nextMove = game.hintNextMove();
-        highlightButton(nextMove);
+        hintSearch->start(game.snapshotBoard()); // A newer search replaces a running one.
+        hintProgress->setValue(0);
+        hintProgress->show();
     }
     catch (const std::exception &e)
     {
@@ -276,29 +300,58 @@ void MainWindow::hintAction()
     }
 }
 
-void MainWindow::updateCells()
+void MainWindow::seekHistory(int moveIndex)
 {
     try
     {
-        for (int i = 0; i < ui->gridLayout->count(); ++i)
+        if (moveIndex != game.getNumMoves())
         {
-            QLayoutItem *item = ui->gridLayout->itemAt(i);
-            QPushButton *button = qobject_cast<QPushButton *>(item->widget());
-            GameLogic::Move move = getButtonRowCol(button);
-            button->setText(QString::number(game.getBoardValue(move)));
-            if (show_colors)
-                button->setStyleSheet("background-color: " + getColorForValue(button->text()).name() + ";");
+            game.seekTo(moveIndex);
+            if (game.isWin())
+            {
+                disable_all(); // Seeking to the winning move shows the won board.
+            }
             else
-                button->setStyleSheet("");
+            {
+                enable_all(); // The board can be played again after seeking back from a win.
+            }
+            updateCells();
         }
+    }
+    catch (const std::exception &e)
+    {
+        QMessageBox::warning(this, "Error", "Unexpected error occured:\n" + QString(e.what()));
+    }
+}
 
-        // Update number of moves
-        ui->label_moves->setText(QString("Moves: %1").arg(game.getNumMoves()));
+void MainWindow::updateHistorySlider()
+{
+    QSignalBlocker blocker(ui->slider_history); // Moving the slider here must not seek again.
+    ui->slider_history->setMaximum(game.getHistorySize());
+    ui->slider_history->setValue(game.getNumMoves());
+}
 
-        // Update state of the game
-        ui->actionHint->setEnabled(game.isCanHint());
-        ui->actionRedo->setEnabled(game.isCanRedo());
-        ui->actionUndo->setEnabled(game.isCanUndo());
+void MainWindow::newGameFromSeed()
+{
+    try
+    {
+        bool ok;
+        QString text = QInputDialog::getText(this, "New Game from Seed", QString("Seed (difficulty %1):").arg(game.getDifficulty()), QLineEdit::Normal, QString::number(game.getSeed()), &ok);
+        if (!ok)
+        {
+            return;
+        }
+        quint64 seed = text.trimmed().toULongLong(&ok);
+        if (!ok)
+        {
+            QMessageBox::warning(this, "Error", "Invalid seed.");
+            return;
+        }
+        game.setSeed(seed);
+        game.init();
+        enable_all();
+        updateCells();
+        startSession();
     }
     catch (const std::exception &e)
     {
@@ -306,113 +359,142 @@ void MainWindow::updateCells()
     }
 }
 
-void MainWindow::highlightButton(const GameLogic::Move &move)
+void MainWindow::changeBoardSize()
 {
-    QPushButton *button = getButtonByMove(move);
-    if (button)
+    try
+    {
+        bool ok;
+        int size = QInputDialog::getInt(this, "Board Size", "Rows and columns:", game.getSize(), 3, MAX_SIZE, 1, &ok);
+        if (!ok || size == game.getSize() || !showPopup(2))
+        {
+            return;
+        }
+        game.setSize(size);
+        game.init();
+        enable_all();
+        updateCells(); // The board widget fits the new board into the window.
+        startSession();
+    }
+    catch (const std::exception &e)
     {
-        button->setStyleSheet(button->styleSheet().append(QString("border: 5px solid yellow;")));
-        button->setStyleSheet(button->styleSheet().append(QString("padding: 5px;")));
+        QMessageBox::warning(this, "Error", "Unexpected error occured:\n" + QString(e.what()));
     }
 }
 
-void MainWindow::highlightButton(QPushButton *button)
+void MainWindow::startSession(bool keepHistory)
 {
-    if (button)
+    ui->statusbar->showMessage(QString("Seed: %1").arg(game.getSeed()));
+
+    // Sessions are archived for replay, a game that cannot be logged is still played.
+    QDir sessions(sessionsPath());
+    if (sessions.mkpath("."))
     {
-        button->setStyleSheet(button->styleSheet().append(QString("border: 5px solid yellow;")));
-        button->setStyleSheet(button->styleSheet().append(QString("padding: 5px;")));
+        // Names are timestamps, so the newest logs come first. One place is left for the new log.
+        QFileInfoList logs = sessions.entryInfoList({"*.t9log"}, QDir::Files, QDir::Name | QDir::Reversed);
+        for (int i = MAX_SESSION_LOGS - 1; i < logs.size(); ++i)
+        {
+            QFile::remove(logs[i].filePath());
+        }
+        QString name = QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss-zzz") + ".t9log";
+        game.startMoveLog(sessions.filePath(name).toStdString(), keepHistory);
     }
 }
 
-QColor MainWindow::getColorForValue(const QString &value)
+void MainWindow::resumeSession()
 {
-    if (value == "1")
-        return QColor(255, 192, 203); // Pastel Pink
-    if (value == "2")
-        return QColor(173, 216, 230); // Pastel Cyan
-    if (value == "3")
-        return QColor(255, 255, 224); // Pastel Yellow
-    if (value == "4")
-        return QColor(255, 182, 100); // Pastel Red
-    if (value == "5")
-        return QColor(144, 238, 144); // Pastel Green
-    if (value == "6")
-        return QColor(255, 218, 185); // Pastel Peach
-    if (value == "7")
-        return QColor(221, 160, 221); // Pastel Violet
-    if (value == "8")
-        return QColor(240, 230, 140); // Pastel Olive
-    if (value == "9")
-        return QColor(255, 160, 122); // Pastel Salmon
-    return QColor(255, 255, 255);     // Default color (white)
+    // The snapshot is saved when the window closes, so its log is the newest one.
+    QFileInfoList logs = QDir(sessionsPath()).entryInfoList({"*.t9log"}, QDir::Files, QDir::Name | QDir::Reversed);
+    if (!logs.isEmpty() && game.resumeMoveLog(logs.first().filePath().toStdString()))
+    {
+        ui->statusbar->showMessage(QString("Seed: %1").arg(game.getSeed()));
+        return;
+    }
+    startSession(true); // The restored history is written to the new log, so it can still be undone.
 }
 
-void MainWindow::disable_all()
+void MainWindow::updateCells()
 {
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
+    try
     {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        HoverButton *button = qobject_cast<HoverButton *>(item->widget());
-        if (button)
-        {
-            disconnect(button, &HoverButton::clicked, this, &MainWindow::playCell);
-            disconnect(button, &HoverButton::hovered, this, &MainWindow::hoverEffect);
-            disconnect(button, &HoverButton::unhovered, this, &MainWindow::unHoverEffect);
-        }
+        ui->board->refresh(); // Only cells whose value changed since they were last shown are repainted.
+        updateStatus();
+    }
+    catch (const std::exception &e)
+    {
+        QMessageBox::warning(this, "Error", "Unexpected error occured:\n" + QString(e.what()));
     }
 }
 
-void MainWindow::enable_all()
+void MainWindow::updateCells(const GameLogic::Move &move)
 {
-    disable_all(); // To prevent errors.
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
+    try
     {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        HoverButton *button = qobject_cast<HoverButton *>(item->widget());
-        if (button)
-        {
-            connect(button, &HoverButton::clicked, this, &MainWindow::playCell);
-            connect(button, &HoverButton::hovered, this, &MainWindow::hoverEffect);
-            connect(button, &HoverButton::unhovered, this, &MainWindow::unHoverEffect);
-        }
+        ui->board->refreshLines(move); // A move only changes its row and column.
+        updateStatus();
+    }
+    catch (const std::exception &e)
+    {
+        QMessageBox::warning(this, "Error", "Unexpected error occured:\n" + QString(e.what()));
     }
 }
 
-GameLogic::Move MainWindow::getButtonRowCol(QPushButton *button) const
+void MainWindow::updateStatus()
 {
-    if (button)
-    {
-        QString buttonName = button->objectName(); // Get name of the button.
+    // A hint is only valid for the board it was computed for.
+    cancelHint();
+    ui->board->clearHint();
 
-        // Extract row and column from the button name.
-        if (buttonName.startsWith("b") && buttonName.length() == 3) // Check if the name is in the expected format.
-        {
-            int row = buttonName[1].digitValue(); // Get the first index (row)
-            int col = buttonName[2].digitValue(); // Get the second index (col)
-            return GameLogic::Move({row, col});
-        }
+    // Update number of moves
+    ui->label_moves->setText(QString("Moves: %1").arg(game.getNumMoves()));
+
+    // Update state of the game
+    ui->actionHint->setEnabled(game.isCanHint());
+    ui->actionRedo->setEnabled(game.isCanRedo());
+    ui->actionUndo->setEnabled(game.isCanUndo());
+
+    updateHistorySlider();
+}
+
+void MainWindow::highlightCell(const GameLogic::Move &move)
+{
+    ui->board->setHint(move);
+}
+
+void MainWindow::cancelHint()
+{
+    hintSearch->cancel(); // Results of the search still queued to this thread are no longer current.
+    hintProgress->hide();
+}
+
+void MainWindow::showHintProgress(uint64_t search, int percent)
+{
+    if (hintSearch->isCurrent(search))
+    {
+        hintProgress->setValue(percent);
     }
-    return GameLogic::Move({-1, -1});
 }
 
-QPushButton *MainWindow::getButtonByMove(const GameLogic::Move &move) const
+void MainWindow::showHint(uint64_t search, GameLogic::Move move)
 {
-    for (int i = 0; i < ui->gridLayout->count(); ++i)
+    if (!hintSearch->isCurrent(search))
     {
-        QLayoutItem *item = ui->gridLayout->itemAt(i);
-        if (item)
-        {
-            QWidget *widget = item->widget();
-            if (widget && qobject_cast<QPushButton *>(widget))
-            {
-                QPushButton *button = qobject_cast<QPushButton *>(widget);
-                if (button->objectName().contains(QString::number(move.row) + QString::number(move.col), Qt::CaseInsensitive))
-                {
-                    return button;
-                }
-            }
-        }
+        return; // Result of a cancelled search, the board changed since.
+    }
+    hintProgress->hide();
+    if (move.row < 0)
+    {
+        ui->statusbar->showMessage("No hint for this board.", 3000);
+        return;
     }
-    return nullptr;
+    highlightCell(move);
+}
+
+void MainWindow::disable_all()
+{
+    ui->board->setEnabled(false);
+}
+
+void MainWindow::enable_all()
+{
+    ui->board->setEnabled(true);
 }
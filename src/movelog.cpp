@@ -0,0 +1,446 @@
+/**
+ * @file movelog.cpp
+ * @brief Implementation of MoveLogWriter and MoveLogReader class methods.
+ *
+ * Events are packed into a 64-bit accumulator and written in whole bytes.
+ * A flush also writes the last partial byte and the number of events, then
+ * moves the file position back so the next events complete that byte.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "movelog.hpp"
+#include "gamelogic.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    constexpr std::size_t BUFFER_BYTES = 1 << 16; // Bytes collected before a write.
+
+    // Reads event codes in order, refilling a 64-bit accumulator a byte at a time.
+    class EventDecoder
+    {
+    public:
+        EventDecoder(const unsigned char *data, int bits) : data(data), bits(bits), mask((1u << bits) - 1), buffer(0), buffered(0) {}
+
+        uint32_t next()
+        {
+            while (buffered < bits)
+            {
+                buffer |= static_cast<uint64_t>(*data++) << buffered;
+                buffered += 8;
+            }
+            uint32_t code = static_cast<uint32_t>(buffer) & mask;
+            buffer >>= bits;
+            buffered -= bits;
+            return code;
+        }
+
+        // Target of a seek, stored in slots after the seek code.
+        uint64_t nextIndex(int slots)
+        {
+            uint64_t index = 0;
+            for (int i = 0; i < slots; ++i)
+            {
+                index |= static_cast<uint64_t>(next()) << (i * bits);
+            }
+            return index;
+        }
+
+    private:
+        const unsigned char *data;
+        int bits;
+        uint32_t mask;
+        uint64_t buffer;
+        int buffered;
+    };
+}
+
+int MoveLogFormat::bitsPerEvent(int size)
+{
+    uint32_t codes = static_cast<uint32_t>(size) * size + 3; // Moves, undo, redo and seek.
+    int bits = 1;
+    while ((1u << bits) < codes)
+    {
+        ++bits;
+    }
+    return bits;
+}
+
+int MoveLogFormat::seekSlots(int size)
+{
+    int bits = bitsPerEvent(size);
+    return (32 + bits - 1) / bits;
+}
+
+MoveLogWriter::MoveLogWriter() : file(nullptr), size(0), bits(0), events(0), pending(0), pendingBits(0) {}
+
+MoveLogWriter::~MoveLogWriter()
+{
+    close();
+}
+
+bool MoveLogWriter::open(const std::string &path, int size, uint64_t seed, const int *board)
+{
+    close();
+    file = std::fopen(path.c_str(), "wb+");
+    if (!file)
+    {
+        return false;
+    }
+    this->size = size;
+    bits = MoveLogFormat::bitsPerEvent(size);
+    events = 0;
+    pending = 0;
+    pendingBits = 0;
+
+    unsigned char header[MoveLogFormat::HEADER_BYTES];
+    uint32_t fields[4] = {MoveLogFormat::MAGIC, MoveLogFormat::VERSION, static_cast<uint32_t>(size), static_cast<uint32_t>(bits)};
+    std::memcpy(header, fields, sizeof(fields));
+    std::memcpy(header + 16, &seed, sizeof(seed));
+    std::memcpy(header + MoveLogFormat::EVENTS_OFFSET, &events, sizeof(events));
+    buffer.assign(header, header + sizeof(header));
+    for (int i = 0; i < size * size; ++i)
+    {
+        buffer.push_back(static_cast<unsigned char>(board[i]));
+    }
+    buffer.reserve(BUFFER_BYTES + 8);
+    flush();
+    return true;
+}
+
+bool MoveLogWriter::append(const std::string &path)
+{
+    close();
+    file = std::fopen(path.c_str(), "rb+");
+    if (!file)
+    {
+        return false;
+    }
+    unsigned char header[MoveLogFormat::HEADER_BYTES];
+    uint32_t fields[4] = {};
+    bool valid = std::fread(header, 1, sizeof(header), file) == sizeof(header);
+    if (valid)
+    {
+        std::memcpy(fields, header, sizeof(fields));
+        std::memcpy(&events, header + MoveLogFormat::EVENTS_OFFSET, sizeof(events));
+        size = static_cast<int>(fields[2]);
+        bits = static_cast<int>(fields[3]);
+        valid = fields[0] == MoveLogFormat::MAGIC && fields[1] >= MoveLogFormat::MIN_VERSION && fields[1] <= MoveLogFormat::VERSION &&
+                size >= 1 && size <= MAX_SIZE && bits == MoveLogFormat::bitsPerEvent(size);
+    }
+    if (valid && fields[1] != MoveLogFormat::VERSION) // New events may be seeks, which older versions do not have.
+    {
+        uint32_t version = MoveLogFormat::VERSION;
+        valid = std::fseek(file, 4, SEEK_SET) == 0 && std::fwrite(&version, sizeof(version), 1, file) == 1;
+    }
+
+    // Continue at the byte holding the end of the last event, its bits go back into pending.
+    long end = 0;
+    pending = 0;
+    pendingBits = 0;
+    if (valid)
+    {
+        uint64_t eventBits = events * static_cast<uint64_t>(bits);
+        end = static_cast<long>(MoveLogFormat::HEADER_BYTES + static_cast<std::size_t>(size) * size + eventBits / 8);
+        pendingBits = static_cast<int>(eventBits % 8);
+        unsigned char last = 0;
+        valid = std::fseek(file, 0, SEEK_END) == 0 && std::ftell(file) >= end + (pendingBits > 0 ? 1 : 0) &&
+                std::fseek(file, end, SEEK_SET) == 0 && (pendingBits == 0 || std::fread(&last, 1, 1, file) == 1) &&
+                std::fseek(file, end, SEEK_SET) == 0;
+        pending = last & ((1u << pendingBits) - 1);
+    }
+    if (!valid)
+    {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+    buffer.clear();
+    buffer.reserve(BUFFER_BYTES + 8);
+    return true;
+}
+
+void MoveLogWriter::record(uint32_t code)
+{
+    pending |= static_cast<uint64_t>(code) << pendingBits;
+    pendingBits += bits;
+    while (pendingBits >= 8)
+    {
+        buffer.push_back(static_cast<unsigned char>(pending));
+        pending >>= 8;
+        pendingBits -= 8;
+    }
+    ++events;
+    if (buffer.size() >= BUFFER_BYTES)
+    {
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+}
+
+void MoveLogWriter::recordMove(int row, int col)
+{
+    record(static_cast<uint32_t>(row * size + col));
+}
+
+void MoveLogWriter::recordUndo()
+{
+    record(static_cast<uint32_t>(size * size));
+}
+
+void MoveLogWriter::recordRedo()
+{
+    record(static_cast<uint32_t>(size * size + 1));
+}
+
+void MoveLogWriter::recordSeek(int moveIndex)
+{
+    record(static_cast<uint32_t>(size * size + 2));
+    uint32_t index = static_cast<uint32_t>(moveIndex);
+    uint32_t mask = (1u << bits) - 1;
+    for (int i = 0; i < MoveLogFormat::seekSlots(size); ++i)
+    {
+        record(static_cast<uint32_t>((static_cast<uint64_t>(index) >> (i * bits)) & mask));
+    }
+}
+
+void MoveLogWriter::flush()
+{
+    if (!file)
+    {
+        return;
+    }
+    std::fwrite(buffer.data(), 1, buffer.size(), file);
+    buffer.clear();
+    long end = std::ftell(file);
+    if (pendingBits > 0)
+    {
+        unsigned char last = static_cast<unsigned char>(pending); // Completed by the next events.
+        std::fwrite(&last, 1, 1, file);
+    }
+    std::fseek(file, static_cast<long>(MoveLogFormat::EVENTS_OFFSET), SEEK_SET);
+    std::fwrite(&events, sizeof(events), 1, file);
+    std::fseek(file, end, SEEK_SET);
+    std::fflush(file);
+}
+
+void MoveLogWriter::close()
+{
+    if (file)
+    {
+        flush();
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+bool MoveLogWriter::isOpen() const
+{
+    return file != nullptr;
+}
+
+uint64_t MoveLogWriter::getEventCount() const
+{
+    return events;
+}
+
+MoveLogReader::MoveLogReader(const std::string &path) : size(0), bits(0), seed(0), events(0), eventData(nullptr)
+{
+    if (!file.open(path))
+    {
+        throw std::runtime_error("Cannot open move log " + path);
+    }
+    uint32_t fields[4] = {};
+    bool valid = file.size() >= MoveLogFormat::HEADER_BYTES;
+    if (valid)
+    {
+        std::memcpy(fields, file.data(), sizeof(fields));
+        std::memcpy(&seed, file.data() + 16, sizeof(seed));
+        std::memcpy(&events, file.data() + MoveLogFormat::EVENTS_OFFSET, sizeof(events));
+        size = static_cast<int>(fields[2]);
+        bits = static_cast<int>(fields[3]);
+        valid = fields[0] == MoveLogFormat::MAGIC && fields[1] >= MoveLogFormat::MIN_VERSION && fields[1] <= MoveLogFormat::VERSION &&
+                size >= 1 && size <= MAX_SIZE && bits == MoveLogFormat::bitsPerEvent(size);
+    }
+    if (valid)
+    {
+        std::size_t board = static_cast<std::size_t>(size) * size;
+        std::size_t available = file.size() - MoveLogFormat::HEADER_BYTES;
+        valid = board <= available && events <= (available - board) * 8 / bits;
+    }
+    if (!valid)
+    {
+        throw std::runtime_error("File " + path + " is not a valid move log");
+    }
+    eventData = file.data() + MoveLogFormat::HEADER_BYTES + static_cast<std::size_t>(size) * size;
+    file.adviseSequential();
+}
+
+int MoveLogReader::getSize() const
+{
+    return size;
+}
+
+uint64_t MoveLogReader::getSeed() const
+{
+    return seed;
+}
+
+uint64_t MoveLogReader::getEventCount() const
+{
+    return events;
+}
+
+std::vector<int> MoveLogReader::getInitialBoard() const
+{
+    const unsigned char *board = file.data() + MoveLogFormat::HEADER_BYTES;
+    return std::vector<int>(board, board + size * size);
+}
+
+void MoveLogReader::replay(GameLogic &game) const
+{
+    const uint32_t cells = static_cast<uint32_t>(size) * size;
+    const int slots = MoveLogFormat::seekSlots(size);
+    game.setSize(size);
+    std::vector<int> initial = getInitialBoard();
+    game.setBoard(initial.data(), seed);
+
+    std::vector<GameLogic::Move> moves; // Run of moves played as one batch.
+    int undos = 0;                       // Run of undos played at once.
+    auto playPending = [&]
+    {
+        if (!moves.empty())
+        {
+            game.makeMoves(moves);
+            moves.clear();
+        }
+        if (undos > 0)
+        {
+            if (undos > game.getNumMoves())
+            {
+                throw std::runtime_error("Move log undoes more moves than were played");
+            }
+            game.undoMoves(undos);
+            undos = 0;
+        }
+    };
+
+    EventDecoder decoder(eventData, bits);
+    for (uint64_t i = 0; i < events; ++i)
+    {
+        uint32_t code = decoder.next();
+        if (code < cells)
+        {
+            if (undos > 0)
+                playPending();
+            moves.push_back({static_cast<int>(code / size), static_cast<int>(code % size)});
+        }
+        else if (code == cells)
+        {
+            if (!moves.empty())
+                playPending();
+            ++undos;
+        }
+        else if (code == cells + 1)
+        {
+            playPending();
+            if (game.getNumMoves() >= game.getHistorySize())
+            {
+                throw std::runtime_error("Move log redoes a move that was not undone");
+            }
+            game.seekTo(game.getNumMoves() + 1);
+        }
+        else if (code == cells + 2)
+        {
+            playPending();
+            if (events - i - 1 < static_cast<uint64_t>(slots))
+            {
+                throw std::runtime_error("Move log ends inside a seek");
+            }
+            uint64_t target = decoder.nextIndex(slots);
+            i += slots;
+            if (target > static_cast<uint64_t>(game.getHistorySize()))
+            {
+                throw std::runtime_error("Move log seeks to a move that was not played");
+            }
+            game.seekTo(static_cast<int>(target));
+        }
+        else
+        {
+            throw std::runtime_error("Move log has an invalid event " + std::to_string(code));
+        }
+    }
+    playPending();
+}
+
+bool MoveLogReader::verifySolution(int *moves) const
+{
+    const uint32_t cells = static_cast<uint32_t>(size) * size;
+    const int slots = MoveLogFormat::seekSlots(size);
+    std::vector<uint32_t> played; // Cells of all moves, the first cursor ones are on the board.
+    std::size_t cursor = 0;
+    EventDecoder decoder(eventData, bits);
+    for (uint64_t i = 0; i < events; ++i)
+    {
+        uint32_t code = decoder.next();
+        if (code < cells)
+        {
+            played.resize(cursor); // A new move drops the moves that could be redone.
+            played.push_back(code);
+            ++cursor;
+        }
+        else if (code == cells)
+        {
+            if (cursor == 0)
+                throw std::runtime_error("Move log undoes more moves than were played");
+            --cursor;
+        }
+        else if (code == cells + 1)
+        {
+            if (cursor == played.size())
+                throw std::runtime_error("Move log redoes a move that was not undone");
+            ++cursor;
+        }
+        else if (code == cells + 2)
+        {
+            if (events - i - 1 < static_cast<uint64_t>(slots))
+                throw std::runtime_error("Move log ends inside a seek");
+            uint64_t target = decoder.nextIndex(slots);
+            i += slots;
+            if (target > played.size())
+                throw std::runtime_error("Move log seeks to a move that was not played");
+            cursor = static_cast<std::size_t>(target);
+        }
+        else
+        {
+            throw std::runtime_error("Move log has an invalid event " + std::to_string(code));
+        }
+    }
+
+    // Moves commute: cell (i, j) goes up by the presses of row i and column j, its own presses counted once.
+    std::vector<int> rows(size, 0), cols(size, 0), presses(cells, 0);
+    for (std::size_t i = 0; i < cursor; ++i)
+    {
+        ++rows[played[i] / size];
+        ++cols[played[i] % size];
+        ++presses[played[i]];
+    }
+    if (moves)
+    {
+        *moves = static_cast<int>(cursor);
+    }
+    const unsigned char *board = file.data() + MoveLogFormat::HEADER_BYTES;
+    for (uint32_t cell = 0; cell < cells; ++cell)
+    {
+        int added = (rows[cell / size] + cols[cell % size] - presses[cell]) % 9;
+        if ((board[cell] - 1 + added) % 9 + 1 != 9)
+        {
+            return false;
+        }
+    }
+    return true;
+}
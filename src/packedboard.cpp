@@ -0,0 +1,159 @@
+/**
+ * @file packedboard.cpp
+ * @brief Implementation of PackedBoard class methods.
+ *
+ * All wraparound handling works on whole words: nibbles that overflowed to
+ * 10 or underflowed to 0 are found with an exact zero-nibble test and fixed
+ * by subtracting or adding 9, so no cell is ever tested with a branch.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+#include "packedboard.hpp"
+
+namespace
+{
+    constexpr uint64_t NIBBLE_ONES = 0x1111111111111111ULL;  // 1 in every nibble.
+    constexpr uint64_t NIBBLE_LOW = 0x7777777777777777ULL;   // Low three bits of every nibble.
+    constexpr uint64_t NIBBLE_HIGH = 0x8888888888888888ULL;  // High bit of every nibble.
+    constexpr uint64_t NIBBLE_TENS = 0xAAAAAAAAAAAAAAAAULL;  // 10 in every nibble.
+    constexpr uint64_t NIBBLE_NINES = 0x9999999999999999ULL; // 9 in every nibble, a won word.
+
+    // Return 0x1 in every nibble of x that is zero, 0x0 otherwise. Exact, no carries between nibbles.
+    inline uint64_t zeroNibbles(uint64_t x)
+    {
+        uint64_t low = (x & NIBBLE_LOW) + NIBBLE_LOW; // High bit set if any of the low three bits is set.
+        return (~(low | x | NIBBLE_LOW) & NIBBLE_HIGH) >> 3;
+    }
+
+    // Count nibbles of x equal to 9. Unused nibbles hold 9 before and after a move, so they cancel out in differences.
+    inline int nines(uint64_t x)
+    {
+        uint64_t ones = zeroNibbles(x ^ NIBBLE_NINES);
+        uint64_t bytes = (ones + (ones >> 4)) & 0x0F0F0F0F0F0F0F0FULL; // Up to 2 per byte.
+        return static_cast<int>((bytes * 0x0101010101010101ULL) >> 56);
+    }
+
+    // Turn every nibble that reached 10 back into 1.
+    inline uint64_t wrapUp(uint64_t x)
+    {
+        return x - zeroNibbles(x ^ NIBBLE_TENS) * 9;
+    }
+
+    // Turn every nibble that reached 0 back into 9.
+    inline uint64_t wrapDown(uint64_t x)
+    {
+        return x + zeroNibbles(x) * 9;
+    }
+}
+
+PackedBoard::PackedBoard() : size(0), stride(0) {}
+
+void PackedBoard::reset(int size)
+{
+    this->size = size;
+    stride = (size + 15) / 16;
+    words.assign(static_cast<std::size_t>(size) * stride, NIBBLE_NINES);
+}
+
+void PackedBoard::assign(const int *values, int size)
+{
+    reset(size);
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            uint64_t &word = words[row * stride + (col >> 4)];
+            int shift = (col & 15) * 4;
+            word = (word & ~(0xFULL << shift)) | (static_cast<uint64_t>(values[row * size + col]) << shift);
+        }
+    }
+}
+
+void PackedBoard::copyTo(int *values) const
+{
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            values[row * size + col] = value(row, col);
+        }
+    }
+}
+
+uint64_t PackedBoard::rowMask(int word) const
+{
+    int used = size - word * 16; // Cells of the row stored in this word.
+    return used >= 16 ? NIBBLE_ONES : NIBBLE_ONES & ((1ULL << (used * 4)) - 1);
+}
+
+int PackedBoard::increment(int row, int col)
+{
+    int change = 0;
+
+    // Whole row, up to 16 cells per add.
+    uint64_t *line = words.data() + row * stride;
+    for (int i = 0; i < stride; ++i)
+    {
+        uint64_t word = wrapUp(line[i] + rowMask(i));
+        change += nines(line[i]) - nines(word);
+        line[i] = word;
+    }
+
+    // Column, one nibble per row. The crossing cell was already incremented with the row.
+    int shift = (col & 15) * 4;
+    uint64_t bit = 1ULL << shift;
+    uint64_t *cell = words.data() + (col >> 4);
+    for (int i = 0; i < size; ++i, cell += stride)
+    {
+        if (i != row)
+        {
+            uint64_t value = (*cell >> shift) & 0xF;
+            change += (value == 9) - (value == 8);
+            *cell = wrapUp(*cell + bit);
+        }
+    }
+    return change;
+}
+
+int PackedBoard::decrement(int row, int col)
+{
+    int change = 0;
+    uint64_t *line = words.data() + row * stride;
+    for (int i = 0; i < stride; ++i)
+    {
+        uint64_t word = wrapDown(line[i] - rowMask(i)); // Values are at least 1, so no borrow crosses nibbles.
+        change += nines(line[i]) - nines(word);
+        line[i] = word;
+    }
+
+    int shift = (col & 15) * 4;
+    uint64_t bit = 1ULL << shift;
+    uint64_t *cell = words.data() + (col >> 4);
+    for (int i = 0; i < size; ++i, cell += stride)
+    {
+        if (i != row)
+        {
+            uint64_t value = (*cell >> shift) & 0xF;
+            change += (value == 9) - (value == 1);
+            *cell = wrapDown(*cell - bit);
+        }
+    }
+    return change;
+}
+
+bool PackedBoard::isSolved() const
+{
+    for (uint64_t word : words)
+    {
+        if (word != NIBBLE_NINES)
+            return false;
+    }
+    return true;
+}
+
+std::size_t PackedBoard::bytes() const
+{
+    return words.size() * sizeof(uint64_t);
+}
@@ -0,0 +1,219 @@
+/**
+ * @file puzzlegenerator.cpp
+ * @brief Implementation of PuzzleGenerator class methods.
+ *
+ * A puzzle is made by choosing a press count for every cell and undoing
+ * those presses on a won board, which takes O(N^2) no matter how many
+ * presses there are. When the board size is divisible by 3 the solution of
+ * a board is unique, so press counts in range [0, 8] that add up to the
+ * requested distance give a puzzle of exactly that distance. Other sizes
+ * are scrambled with that many presses and kept only if the Solver agrees.
+ * Without a requested distance every cell gets a random press count, so
+ * all solvable boards are equally likely.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+#include "puzzlegenerator.hpp"
+#include "boardsymmetry.hpp"
+#include "gamerandom.hpp"
+#include "solver.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    constexpr int SHARDS = 64;     // Parts of the set of generated boards.
+    constexpr int BATCH = 256;     // Puzzles a thread collects before passing them to the sink.
+}
+
+PuzzleGenerator::PuzzleGenerator(const Options &options) : options(options), shards(SHARDS), found(0), attempts(0), duplicates(0)
+{
+    if (options.size < 1)
+    {
+        throw std::invalid_argument("Cannot generate puzzles of size " + std::to_string(options.size));
+    }
+    if (options.threads < 1)
+    {
+        throw std::invalid_argument("Cannot generate puzzles with " + std::to_string(options.threads) + " threads");
+    }
+    if (options.distance > 8 * options.size * options.size)
+    {
+        throw std::invalid_argument("Cannot generate puzzles with distance " + std::to_string(options.distance));
+    }
+    if (options.symmetric && options.size > BoardSymmetry::MAX_CANONICAL_SIZE)
+    {
+        throw std::invalid_argument("Cannot generate symmetric puzzles of size " + std::to_string(options.size));
+    }
+    if (this->options.maxAttempts == 0)
+    {
+        this->options.maxAttempts = 10 * options.count + 1000000;
+    }
+}
+
+uint64_t PuzzleGenerator::run(const Sink &sink)
+{
+    found = 0;
+    attempts = 0;
+    duplicates = 0;
+    for (Shard &shard : shards)
+    {
+        shard.boards.clear();
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < options.threads; ++i)
+    {
+        workers.emplace_back([this, i, &sink]
+                             { work(i, sink); });
+    }
+    work(0, sink); // The calling thread is one of the workers.
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    return found < options.count ? found.load() : options.count;
+}
+
+void PuzzleGenerator::work(int stream, const Sink &sink)
+{
+    const int size = options.size;
+    const int cells = size * size;
+    GameRandom gen(options.seed, static_cast<uint64_t>(stream), GameRandom::Engine::Philox); // Streams of the threads never overlap.
+    std::uniform_int_distribution<int> cell(0, cells - 1);
+    std::uniform_int_distribution<int> press(0, 8);
+
+    std::vector<int> presses(cells);
+    std::vector<int> rowPresses(size);
+    std::vector<int> colPresses(size);
+    std::vector<int> board(cells);
+    std::vector<int> solution(cells);
+    std::string key((cells + 1) / 2, '\0');
+
+    std::vector<unsigned char> pending; // Puzzles not yet passed to the sink, cells followed by distance.
+    std::vector<int> distances;
+    auto flush = [&]
+    {
+        std::lock_guard<std::mutex> guard(sinkLock);
+        for (std::size_t i = 0; i < distances.size(); ++i)
+        {
+            sink(pending.data() + i * cells, distances[i]);
+        }
+        pending.clear();
+        distances.clear();
+    };
+
+    while (found.load(std::memory_order_relaxed) < options.count)
+    {
+        if (attempts.fetch_add(1, std::memory_order_relaxed) >= options.maxAttempts)
+        {
+            break;
+        }
+
+        // Press counts of the puzzle.
+        std::fill(presses.begin(), presses.end(), 0);
+        if (options.distance >= 0 && size % 3 == 0)
+        {
+            for (int placed = 0; placed < options.distance;)
+            {
+                int &count = presses[cell(gen)];
+                if (count < 8) // Press counts up to 8 keep the solution unique.
+                {
+                    ++count;
+                    ++placed;
+                }
+            }
+        }
+        else if (options.distance < 0 && options.presses < 0)
+        {
+            for (int &count : presses)
+            {
+                count = press(gen); // Every solvable board is equally likely.
+            }
+        }
+        else
+        {
+            int count = options.distance >= 0 ? options.distance : options.presses;
+            for (int i = 0; i < count; ++i)
+            {
+                ++presses[cell(gen)];
+            }
+        }
+
+        // Undo the presses on a won board: every cell loses its row and column totals, the pressed cell counted once.
+        std::fill(rowPresses.begin(), rowPresses.end(), 0);
+        std::fill(colPresses.begin(), colPresses.end(), 0);
+        for (int i = 0; i < cells; ++i)
+        {
+            rowPresses[i / size] += presses[i];
+            colPresses[i % size] += presses[i];
+        }
+        for (int i = 0; i < cells; ++i)
+        {
+            board[i] = 9 - (rowPresses[i / size] + colPresses[i % size] - presses[i]) % 9;
+        }
+
+        int distance = Solver::solve(board.data(), size, solution.data());
+        if (options.distance >= 0 && distance != options.distance)
+        {
+            continue; // A shorter solution exists, the puzzle is easier than requested.
+        }
+
+        const int *keyBoard = board.data();
+        BoardSymmetry::Canonical canonical;
+        if (options.symmetric)
+        {
+            canonical = BoardSymmetry::canonicalize(board.data(), size); // Equivalent boards share the canonical form.
+            keyBoard = canonical.values.data();
+        }
+        for (int i = 0; i < cells; i += 2)
+        {
+            key[i / 2] = static_cast<char>(keyBoard[i] | (i + 1 < cells ? keyBoard[i + 1] << 4 : 0));
+        }
+        Shard &shard = shards[std::hash<std::string>()(key) % SHARDS];
+        bool inserted;
+        {
+            std::lock_guard<std::mutex> guard(shard.lock);
+            inserted = shard.boards.insert(key).second;
+        }
+        if (!inserted)
+        {
+            duplicates.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (found.fetch_add(1) >= options.count)
+        {
+            break; // Other threads already found enough.
+        }
+
+        for (int value : board)
+        {
+            pending.push_back(static_cast<unsigned char>(value));
+        }
+        distances.push_back(distance);
+        if (static_cast<int>(distances.size()) == BATCH)
+        {
+            flush();
+        }
+    }
+    flush();
+}
+
+uint64_t PuzzleGenerator::getAttempts() const
+{
+    uint64_t tried = attempts.load();
+    return tried < options.maxAttempts ? tried : options.maxAttempts;
+}
+
+uint64_t PuzzleGenerator::getDuplicates() const
+{
+    return duplicates;
+}
+
+bool PuzzleGenerator::isExact() const
+{
+    return Solver::isExact(options.size);
+}
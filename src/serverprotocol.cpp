@@ -0,0 +1,600 @@
+/**
+ * @file serverprotocol.cpp
+ * @brief Implementation of ServerProtocol class methods.
+ *
+ * Binary request, 32 bytes: command (u8), flags (u8, 1 = seeded), reserved (u16), tag (u32), session (u64),
+ * row or board size of New (i32), column or difficulty of New (i32), seed (u64).
+ *
+ * Binary response, 44 bytes and a payload: length of the rest of the response (u32), command (u8), status
+ * (u8, 0 = ok, 1 = error), won (u8), reserved (u8), tag (u32), session (u64), moves (i32), row and column of
+ * Hint (i32 each), board size (i32), seed (u64). The payload is the board, one byte per cell in row-major
+ * order, for New and State, or the error text of a failed request.
+ *
+ * The JSON parser only accepts flat objects, which is all the protocol uses.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "serverprotocol.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr GameServer::Command COMMANDS[] = {GameServer::Command::New, GameServer::Command::Move, GameServer::Command::Undo,
+                                                GameServer::Command::Redo, GameServer::Command::Hint, GameServer::Command::State,
+                                                GameServer::Command::Close};
+    constexpr unsigned char FLAG_SEEDED = 1;
+
+    // Key and raw value of a JSON object member, strings are unescaped.
+    struct Field
+    {
+        std::string key;
+        std::string value;
+        bool quoted;
+    };
+
+    void skipSpace(const std::string &text, std::size_t &at)
+    {
+        while (at < text.size() && (text[at] == ' ' || text[at] == '\t' || text[at] == '\r' || text[at] == '\n'))
+        {
+            ++at;
+        }
+    }
+
+    // Read a JSON string starting at the opening quote.
+    bool readString(const std::string &text, std::size_t &at, std::string &out)
+    {
+        out.clear();
+        ++at;
+        while (at < text.size() && text[at] != '"')
+        {
+            char c = text[at++];
+            if (c != '\\')
+            {
+                out += c;
+                continue;
+            }
+            if (at >= text.size())
+                return false;
+            char escaped = text[at++];
+            switch (escaped)
+            {
+            case 'n':
+                out += '\n';
+                break;
+            case 't':
+                out += '\t';
+                break;
+            case 'r':
+                out += '\r';
+                break;
+            case 'b':
+                out += '\b';
+                break;
+            case 'f':
+                out += '\f';
+                break;
+            case 'u':
+            {
+                if (at + 4 > text.size())
+                    return false;
+                unsigned long code = std::strtoul(text.substr(at, 4).c_str(), nullptr, 16);
+                out += code < 0x80 ? static_cast<char>(code) : '?'; // Names and errors are ASCII.
+                at += 4;
+                break;
+            }
+            default:
+                out += escaped; // \" \\ \/
+                break;
+            }
+        }
+        if (at >= text.size())
+            return false;
+        ++at; // Closing quote.
+        return true;
+    }
+
+    // Split a flat JSON object into its members.
+    bool parseObject(const std::string &text, std::vector<Field> &fields, std::string &error)
+    {
+        fields.clear();
+        std::size_t at = 0;
+        skipSpace(text, at);
+        if (at >= text.size() || text[at] != '{')
+        {
+            error = "Expected a JSON object";
+            return false;
+        }
+        ++at;
+        skipSpace(text, at);
+        if (at < text.size() && text[at] == '}')
+        {
+            ++at;
+        }
+        else
+        {
+            while (true)
+            {
+                Field field;
+                skipSpace(text, at);
+                if (at >= text.size() || text[at] != '"' || !readString(text, at, field.key))
+                {
+                    error = "Expected a member name";
+                    return false;
+                }
+                skipSpace(text, at);
+                if (at >= text.size() || text[at] != ':')
+                {
+                    error = "Expected ':' after \"" + field.key + "\"";
+                    return false;
+                }
+                ++at;
+                skipSpace(text, at);
+                field.quoted = at < text.size() && text[at] == '"';
+                if (field.quoted)
+                {
+                    if (!readString(text, at, field.value))
+                    {
+                        error = "Unterminated string";
+                        return false;
+                    }
+                }
+                else
+                {
+                    std::size_t start = at;
+                    while (at < text.size() && text[at] != ',' && text[at] != '}' && text[at] != ' ' && text[at] != '\t')
+                    {
+                        ++at;
+                    }
+                    field.value = text.substr(start, at - start);
+                    if (field.value.empty() || field.value[0] == '{' || field.value[0] == '[')
+                    {
+                        error = "Expected a number, string or literal for \"" + field.key + "\"";
+                        return false;
+                    }
+                }
+                fields.push_back(std::move(field));
+                skipSpace(text, at);
+                if (at < text.size() && text[at] == ',')
+                {
+                    ++at;
+                    continue;
+                }
+                if (at < text.size() && text[at] == '}')
+                {
+                    ++at;
+                    break;
+                }
+                error = "Expected ',' or '}'";
+                return false;
+            }
+        }
+        skipSpace(text, at);
+        if (at != text.size())
+        {
+            error = "Unexpected text after the object";
+            return false;
+        }
+        return true;
+    }
+
+    bool toUnsigned(const Field &field, uint64_t &value, std::string &error)
+    {
+        char *end = nullptr;
+        errno = 0;
+        value = std::strtoull(field.value.c_str(), &end, 10);
+        if (field.quoted || field.value.empty() || field.value[0] == '-' || *end != '\0' || errno != 0)
+        {
+            error = "\"" + field.key + "\" must be a non-negative integer";
+            return false;
+        }
+        return true;
+    }
+
+    bool toInt(const Field &field, int &value, std::string &error)
+    {
+        char *end = nullptr;
+        errno = 0;
+        long long number = std::strtoll(field.value.c_str(), &end, 10);
+        if (field.quoted || field.value.empty() || *end != '\0' || errno != 0 || number < INT32_MIN || number > INT32_MAX)
+        {
+            error = "\"" + field.key + "\" must be an integer";
+            return false;
+        }
+        value = static_cast<int>(number);
+        return true;
+    }
+
+    bool toBool(const Field &field, bool &value, std::string &error)
+    {
+        if (!field.quoted && (field.value == "true" || field.value == "false"))
+        {
+            value = field.value == "true";
+            return true;
+        }
+        error = "\"" + field.key + "\" must be true or false";
+        return false;
+    }
+
+    bool toCommand(const Field &field, GameServer::Command &command, std::string &error)
+    {
+        for (GameServer::Command candidate : COMMANDS)
+        {
+            if (field.quoted && field.value == ServerProtocol::commandName(candidate))
+            {
+                command = candidate;
+                return true;
+            }
+        }
+        error = "Unknown command \"" + field.value + "\"";
+        return false;
+    }
+
+    void appendString(std::string &out, const std::string &text)
+    {
+        out += '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+                out += c;
+            }
+            else if (c == '\n')
+                out += "\\n";
+            else if (static_cast<unsigned char>(c) < 0x20)
+                out += ' ';
+            else
+                out += c;
+        }
+        out += '"';
+    }
+
+    void putU32(unsigned char *bytes, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+
+    void putU64(unsigned char *bytes, uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+
+    uint32_t getU32(const unsigned char *bytes)
+    {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; --i)
+        {
+            value = value << 8 | bytes[i];
+        }
+        return value;
+    }
+
+    uint64_t getU64(const unsigned char *bytes)
+    {
+        uint64_t value = 0;
+        for (int i = 7; i >= 0; --i)
+        {
+            value = value << 8 | bytes[i];
+        }
+        return value;
+    }
+
+    bool isCommand(uint8_t value)
+    {
+        return value >= static_cast<uint8_t>(GameServer::Command::New) && value <= static_cast<uint8_t>(GameServer::Command::Close);
+    }
+}
+
+const char *ServerProtocol::commandName(GameServer::Command command)
+{
+    switch (command)
+    {
+    case GameServer::Command::New:
+        return "new";
+    case GameServer::Command::Move:
+        return "move";
+    case GameServer::Command::Undo:
+        return "undo";
+    case GameServer::Command::Redo:
+        return "redo";
+    case GameServer::Command::Hint:
+        return "hint";
+    case GameServer::Command::State:
+        return "state";
+    case GameServer::Command::Close:
+        return "close";
+    }
+    return "unknown";
+}
+
+bool ServerProtocol::parseRequest(const std::string &line, GameServer::Request &request, std::string &error)
+{
+    request = GameServer::Request();
+    error.clear();
+    std::vector<Field> fields;
+    if (!parseObject(line, fields, error))
+    {
+        return false;
+    }
+    bool hasCommand = false;
+    for (const Field &field : fields)
+    {
+        bool valid = true;
+        uint64_t number = 0;
+        if (field.key == "tag")
+        {
+            valid = toUnsigned(field, number, error) && number <= UINT32_MAX;
+            request.tag = static_cast<uint32_t>(number);
+        }
+        else if (field.key == "cmd")
+        {
+            valid = toCommand(field, request.command, error);
+            hasCommand = valid;
+        }
+        else if (field.key == "session")
+            valid = toUnsigned(field, request.session, error);
+        else if (field.key == "row")
+            valid = toInt(field, request.row, error);
+        else if (field.key == "col")
+            valid = toInt(field, request.col, error);
+        else if (field.key == "size")
+            valid = toInt(field, request.size, error);
+        else if (field.key == "difficulty")
+            valid = toInt(field, request.difficulty, error);
+        else if (field.key == "seed")
+        {
+            valid = toUnsigned(field, request.seed, error);
+            request.seeded = valid;
+        }
+        // Other members are ignored, so clients can add their own.
+        if (!valid)
+        {
+            if (error.empty())
+                error = "\"tag\" must fit in 32 bits";
+            return false;
+        }
+    }
+    if (!hasCommand)
+    {
+        error = "Missing \"cmd\"";
+        return false;
+    }
+    return true;
+}
+
+std::string ServerProtocol::formatRequest(const GameServer::Request &request)
+{
+    std::string line = "{\"cmd\":\"";
+    line += commandName(request.command);
+    line += "\",\"tag\":" + std::to_string(request.tag);
+    if (request.command == GameServer::Command::New)
+    {
+        line += ",\"size\":" + std::to_string(request.size) + ",\"difficulty\":" + std::to_string(request.difficulty);
+        if (request.seeded)
+            line += ",\"seed\":" + std::to_string(request.seed);
+    }
+    else
+    {
+        line += ",\"session\":" + std::to_string(request.session);
+        if (request.command == GameServer::Command::Move)
+            line += ",\"row\":" + std::to_string(request.row) + ",\"col\":" + std::to_string(request.col);
+    }
+    line += "}\n";
+    return line;
+}
+
+std::string ServerProtocol::formatResponse(const GameServer::Response &response)
+{
+    std::string line = "{\"tag\":" + std::to_string(response.tag) + ",\"cmd\":\"" + commandName(response.command) + "\"";
+    line += response.ok ? ",\"ok\":true" : ",\"ok\":false";
+    line += ",\"session\":" + std::to_string(response.session);
+    if (!response.ok)
+    {
+        line += ",\"error\":";
+        appendString(line, response.error);
+    }
+    else if (response.command != GameServer::Command::Close)
+    {
+        line += ",\"moves\":" + std::to_string(response.moves);
+        line += response.won ? ",\"won\":true" : ",\"won\":false";
+        if (response.command == GameServer::Command::Hint)
+        {
+            line += ",\"row\":" + std::to_string(response.row) + ",\"col\":" + std::to_string(response.col);
+        }
+        if (!response.board.empty())
+        {
+            line += ",\"size\":" + std::to_string(response.size) + ",\"seed\":" + std::to_string(response.seed) + ",\"board\":\"";
+            std::size_t start = line.size();
+            line.resize(start + response.board.size());
+            for (std::size_t i = 0; i < response.board.size(); ++i)
+            {
+                line[start + i] = static_cast<char>('0' + response.board[i]);
+            }
+            line += '"';
+        }
+    }
+    line += "}\n";
+    return line;
+}
+
+std::string ServerProtocol::formatError(uint32_t tag, const std::string &error)
+{
+    std::string line = "{\"tag\":" + std::to_string(tag) + ",\"ok\":false,\"error\":";
+    appendString(line, error);
+    line += "}\n";
+    return line;
+}
+
+bool ServerProtocol::parseResponse(const std::string &line, GameServer::Response &response, std::string &error)
+{
+    response = GameServer::Response();
+    std::vector<Field> fields;
+    if (!parseObject(line, fields, error))
+    {
+        return false;
+    }
+    for (const Field &field : fields)
+    {
+        bool valid = true;
+        uint64_t number = 0;
+        if (field.key == "tag")
+        {
+            valid = toUnsigned(field, number, error);
+            response.tag = static_cast<uint32_t>(number);
+        }
+        else if (field.key == "cmd")
+            valid = toCommand(field, response.command, error);
+        else if (field.key == "ok")
+            valid = toBool(field, response.ok, error);
+        else if (field.key == "error")
+            response.error = field.value;
+        else if (field.key == "session")
+            valid = toUnsigned(field, response.session, error);
+        else if (field.key == "moves")
+            valid = toInt(field, response.moves, error);
+        else if (field.key == "won")
+            valid = toBool(field, response.won, error);
+        else if (field.key == "row")
+            valid = toInt(field, response.row, error);
+        else if (field.key == "col")
+            valid = toInt(field, response.col, error);
+        else if (field.key == "size")
+            valid = toInt(field, response.size, error);
+        else if (field.key == "seed")
+            valid = toUnsigned(field, response.seed, error);
+        else if (field.key == "board")
+        {
+            response.board.resize(field.value.size());
+            for (std::size_t i = 0; i < field.value.size(); ++i)
+            {
+                response.board[i] = static_cast<unsigned char>(field.value[i] - '0');
+            }
+        }
+        if (!valid)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ServerProtocol::decodeRequest(const unsigned char *bytes, GameServer::Request &request, std::string &error)
+{
+    request = GameServer::Request();
+    request.command = static_cast<GameServer::Command>(bytes[0]);
+    request.tag = getU32(bytes + 4);
+    if (!isCommand(bytes[0]))
+    {
+        error = "Unknown command " + std::to_string(bytes[0]);
+        return false;
+    }
+    request.session = getU64(bytes + 8);
+    int first = static_cast<int>(getU32(bytes + 16));
+    int second = static_cast<int>(getU32(bytes + 20));
+    if (request.command == GameServer::Command::New)
+    {
+        request.size = first;
+        request.difficulty = second;
+    }
+    else
+    {
+        request.row = first;
+        request.col = second;
+    }
+    request.seeded = (bytes[1] & FLAG_SEEDED) != 0;
+    request.seed = getU64(bytes + 24);
+    return true;
+}
+
+void ServerProtocol::encodeRequest(const GameServer::Request &request, unsigned char *bytes)
+{
+    std::memset(bytes, 0, REQUEST_BYTES);
+    bool isNew = request.command == GameServer::Command::New;
+    bytes[0] = static_cast<unsigned char>(request.command);
+    bytes[1] = request.seeded ? FLAG_SEEDED : 0;
+    putU32(bytes + 4, request.tag);
+    putU64(bytes + 8, request.session);
+    putU32(bytes + 16, static_cast<uint32_t>(isNew ? request.size : request.row));
+    putU32(bytes + 20, static_cast<uint32_t>(isNew ? request.difficulty : request.col));
+    putU64(bytes + 24, request.seed);
+}
+
+void ServerProtocol::encodeResponse(const GameServer::Response &response, std::string &frame)
+{
+    const std::string payload = response.ok ? std::string() : response.error;
+    std::size_t payloadBytes = response.ok ? response.board.size() : payload.size();
+    std::size_t start = frame.size();
+    frame.resize(start + RESPONSE_HEADER_BYTES + payloadBytes);
+    unsigned char *bytes = reinterpret_cast<unsigned char *>(&frame[start]);
+    std::memset(bytes, 0, RESPONSE_HEADER_BYTES);
+    putU32(bytes, static_cast<uint32_t>(RESPONSE_HEADER_BYTES - 4 + payloadBytes));
+    bytes[4] = static_cast<unsigned char>(response.command);
+    bytes[5] = response.ok ? 0 : 1;
+    bytes[6] = response.won ? 1 : 0;
+    putU32(bytes + 8, response.tag);
+    putU64(bytes + 12, response.session);
+    putU32(bytes + 20, static_cast<uint32_t>(response.moves));
+    putU32(bytes + 24, static_cast<uint32_t>(response.row));
+    putU32(bytes + 28, static_cast<uint32_t>(response.col));
+    putU32(bytes + 32, static_cast<uint32_t>(response.size));
+    putU64(bytes + 36, response.seed);
+    if (response.ok)
+    {
+        std::memcpy(bytes + RESPONSE_HEADER_BYTES, response.board.data(), payloadBytes);
+    }
+    else
+    {
+        std::memcpy(bytes + RESPONSE_HEADER_BYTES, payload.data(), payloadBytes);
+    }
+}
+
+std::size_t ServerProtocol::responseSize(const unsigned char *bytes)
+{
+    return 4 + static_cast<std::size_t>(getU32(bytes));
+}
+
+bool ServerProtocol::decodeResponse(const unsigned char *bytes, std::size_t size, GameServer::Response &response)
+{
+    response = GameServer::Response();
+    if (size < RESPONSE_HEADER_BYTES || responseSize(bytes) != size)
+    {
+        return false;
+    }
+    response.command = static_cast<GameServer::Command>(bytes[4]);
+    response.ok = bytes[5] == 0;
+    response.won = bytes[6] != 0;
+    response.tag = getU32(bytes + 8);
+    response.session = getU64(bytes + 12);
+    response.moves = static_cast<int>(getU32(bytes + 20));
+    response.row = static_cast<int>(getU32(bytes + 24));
+    response.col = static_cast<int>(getU32(bytes + 28));
+    response.size = static_cast<int>(getU32(bytes + 32));
+    response.seed = getU64(bytes + 36);
+    const unsigned char *payload = bytes + RESPONSE_HEADER_BYTES;
+    std::size_t payloadBytes = size - RESPONSE_HEADER_BYTES;
+    if (!response.ok)
+    {
+        response.error.assign(reinterpret_cast<const char *>(payload), payloadBytes);
+    }
+    else
+    {
+        if (payloadBytes != 0 && payloadBytes != static_cast<std::size_t>(response.size) * response.size)
+        {
+            return false;
+        }
+        response.board.assign(payload, payload + payloadBytes);
+    }
+    return true;
+}
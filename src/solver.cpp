@@ -0,0 +1,413 @@
+/**
+ * @file solver.cpp
+ * @brief Implementation of Solver class methods.
+ *
+ * This file contains the implementation of the solver for the target 9
+ * board. All arithmetic is done modulo 9, because pressing a cell nine times
+ * returns the board to the same state.
+ *
+ * @author Ignat Romanov
+ * @version 1.1
+ * @date 16.10.2026
+ */
+#include "solver.hpp"
+
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr int INVERSE_MOD_9[9] = {0, 1, 5, 0, 7, 2, 0, 4, 8}; // Multiplicative inverses modulo 9, zero if not invertible.
+    constexpr int STACK_LINES = 64;                              // Boards up to this size are solved without heap allocation.
+    constexpr long long SEARCH_BUDGET = 4000000;                 // Cell evaluations allowed for the exhaustive search.
+    constexpr int MAX_REFINEMENTS = 32;                          // Rounds of alternating row/column minimization.
+    constexpr int NO_COST = INT_MAX / 2;
+
+    inline int mod9(int value)
+    {
+        value %= 9;
+        return value < 0 ? value + 9 : value;
+    }
+
+    // Number of presses a cell still needs from its row and column, i.e. 9 - value modulo 9.
+    inline int deficit(int value)
+    {
+        return mod9(-value);
+    }
+
+    // Solve k * x = m modulo 9. Solutions are x = base + step * j for j >= 0 while x < 9.
+    bool solveLinear(int k, int m, int &base, int &step)
+    {
+        k = mod9(k);
+        m = mod9(m);
+        int divisor = k == 0 ? 9 : (k % 3 == 0 ? 3 : 1); // gcd(k, 9)
+        if (m % divisor != 0)
+        {
+            return false;
+        }
+        step = 9 / divisor;
+        if (divisor == 1)
+            base = mod9(m * INVERSE_MOD_9[k]);
+        else if (divisor == 3)
+            base = (m / 3) * (k / 3) % 3; // 1 and 2 are their own inverses modulo 3.
+        else
+            base = 0;
+        return true;
+    }
+
+    // Report the percent done of a solve, false if the solve was cancelled.
+    bool advance(Solver::Monitor *monitor, int percent)
+    {
+        if (!monitor)
+            return true;
+        if (monitor->cancelled.load(std::memory_order_relaxed))
+            return false;
+        if (percent > monitor->percent)
+        {
+            monitor->percent = percent;
+            if (monitor->progress)
+                monitor->progress(percent);
+        }
+        return true;
+    }
+
+    // Cells evaluated by the exhaustive search over row totals, -1 if it exceeds the budget.
+    long long searchCost(int size)
+    {
+        int base, step;
+        solveLinear(1 - size, 0, base, step);
+        long long options = 9 / step;
+        long long perCandidate = static_cast<long long>(size) * size + 162LL * size;
+        long long total = perCandidate;
+        for (int i = 1; i < size; ++i)
+        {
+            total *= options;
+            if (total > SEARCH_BUDGET)
+                return -1;
+        }
+        return total;
+    }
+
+    // Cost of giving every line each of the 9 values, given the totals of the crossing lines.
+    // With byColumn the lines are columns and other holds row totals, otherwise the other way around.
+    void lineCosts(const std::vector<int> &deficits, int size, const std::vector<int> &other, bool byColumn, std::vector<int> &cost)
+    {
+        std::vector<int> histogram(static_cast<std::size_t>(size) * 9, 0);
+        for (int a = 0; a < size; ++a)
+        {
+            for (int b = 0; b < size; ++b)
+            {
+                int line = byColumn ? b : a;
+                int crossing = byColumn ? other[a] : other[b];
+                ++histogram[line * 9 + mod9(crossing - deficits[a * size + b])];
+            }
+        }
+        cost.assign(static_cast<std::size_t>(size) * 9, 0);
+        for (int line = 0; line < size; ++line)
+        {
+            for (int value = 0; value < 9; ++value)
+            {
+                int sum = 0;
+                for (int v = 0; v < 9; ++v)
+                {
+                    sum += histogram[line * 9 + v] * mod9(v + value);
+                }
+                cost[line * 9 + value] = sum;
+            }
+        }
+    }
+
+    // Pick value base[i] + step * j for every line so that all values sum to target modulo 9 at minimum total cost.
+    int chooseLines(const std::vector<int> &cost, const std::vector<int> &base, int step, int target, std::vector<int> &values)
+    {
+        int lines = static_cast<int>(base.size());
+        std::vector<int> best(static_cast<std::size_t>(lines + 1) * 9, NO_COST);
+        std::vector<int> choice(static_cast<std::size_t>(lines) * 9, 0);
+        best[0] = 0;
+        for (int i = 0; i < lines; ++i)
+        {
+            for (int sum = 0; sum < 9; ++sum)
+            {
+                if (best[i * 9 + sum] == NO_COST)
+                    continue;
+                for (int value = base[i]; value < 9; value += step)
+                {
+                    int next = (sum + value) % 9;
+                    int total = best[i * 9 + sum] + cost[i * 9 + value];
+                    if (total < best[(i + 1) * 9 + next])
+                    {
+                        best[(i + 1) * 9 + next] = total;
+                        choice[i * 9 + next] = value;
+                    }
+                }
+            }
+        }
+        if (best[lines * 9 + target] == NO_COST)
+        {
+            return -1;
+        }
+        values.resize(lines);
+        for (int i = lines - 1, sum = target; i >= 0; --i)
+        {
+            values[i] = choice[i * 9 + sum];
+            sum = mod9(sum - values[i]);
+        }
+        return best[lines * 9 + target];
+    }
+
+    // Try every combination of row totals and pick the best column totals for each of them.
+    // Progress goes from percent from to percent to over the combinations.
+    int searchRows(const std::vector<int> &deficits, int size, const std::vector<int> &rowBase, const std::vector<int> &colBase,
+                   int step, int pressTotal, std::vector<int> &rows, std::vector<int> &cols, Solver::Monitor *monitor, int from, int to)
+    {
+        int best = -1;
+        std::vector<int> digits(size, 0), candidate(size), candidateCols, cost;
+        long long combinations = 1, done = 0;
+        for (int a = 0; a + 1 < size; ++a)
+        {
+            combinations *= 9 / step;
+        }
+        while (true)
+        {
+            if (!advance(monitor, from + static_cast<int>((to - from) * done++ / combinations)))
+                return Solver::CANCELLED;
+
+            // Last row total is fixed by the press total.
+            int sum = 0;
+            for (int a = 0; a + 1 < size; ++a)
+            {
+                candidate[a] = rowBase[a] + step * digits[a];
+                sum += candidate[a];
+            }
+            candidate[size - 1] = mod9(pressTotal - sum);
+            if ((candidate[size - 1] - rowBase[size - 1]) % step == 0)
+            {
+                lineCosts(deficits, size, candidate, true, cost);
+                int total = chooseLines(cost, colBase, step, pressTotal, candidateCols);
+                if (total >= 0 && (best < 0 || total < best))
+                {
+                    best = total;
+                    rows = candidate;
+                    cols = candidateCols;
+                }
+            }
+
+            // Advance to the next combination.
+            int a = 0;
+            while (a + 1 < size && ++digits[a] == 9 / step)
+            {
+                digits[a++] = 0;
+            }
+            if (a + 1 >= size)
+                break;
+        }
+        return best;
+    }
+
+    // Alternately pick the best column totals for fixed rows and the best row totals for fixed columns.
+    // Progress goes from percent from to percent to over the rounds.
+    int refineRows(const std::vector<int> &deficits, int size, const std::vector<int> &rowBase, const std::vector<int> &colBase,
+                   int step, int pressTotal, std::vector<int> &rows, std::vector<int> &cols, Solver::Monitor *monitor, int from, int to)
+    {
+        rows = rowBase;
+        int sum = 0;
+        for (int value : rows)
+        {
+            sum += value;
+        }
+        int missing = mod9(pressTotal - sum);
+        if (missing % step != 0)
+        {
+            return -1;
+        }
+        rows[0] = mod9(rows[0] + missing);
+
+        int best = -1;
+        std::vector<int> cost;
+        for (int round = 0; round < MAX_REFINEMENTS; ++round)
+        {
+            if (!advance(monitor, from + (to - from) * round / MAX_REFINEMENTS))
+                return Solver::CANCELLED;
+            lineCosts(deficits, size, rows, true, cost);
+            if (chooseLines(cost, colBase, step, pressTotal, cols) < 0)
+                return -1;
+            lineCosts(deficits, size, cols, false, cost);
+            int total = chooseLines(cost, rowBase, step, pressTotal, rows);
+            if (total < 0)
+                return -1;
+            bool improved = best < 0 || total < best; // Cost never grows, both steps keep the previous choice available.
+            best = total;
+            if (!improved)
+                break;
+        }
+        return best;
+    }
+}
+
+int Solver::solve(const int *board, int size, int *presses, Monitor *monitor)
+{
+    if (size <= 0)
+    {
+        throw std::invalid_argument("Cannot solve board of size " + std::to_string(size));
+    }
+
+    int lineStack[2 * STACK_LINES];
+    std::vector<int> heapLines;
+    int *rows = lineStack;
+    if (size > STACK_LINES)
+    {
+        heapLines.resize(2 * static_cast<std::size_t>(size));
+        rows = heapLines.data();
+    }
+    int *cols = rows + size;
+
+    // Sum deficits over every row and column.
+    for (int b = 0; b < size; ++b)
+    {
+        cols[b] = 0;
+    }
+    for (int a = 0; a < size; ++a)
+    {
+        rows[a] = 0;
+        for (int b = 0; b < size; ++b)
+        {
+            int value = deficit(board[a * size + b]);
+            rows[a] += value;
+            cols[b] += value;
+        }
+    }
+    return solve(board, size, presses, rows, cols, monitor);
+}
+
+int Solver::solve(const int *board, int size, int *presses, const int *rowDeficits, const int *colDeficits, Monitor *monitor)
+{
+    if (size <= 0)
+    {
+        throw std::invalid_argument("Cannot solve board of size " + std::to_string(size));
+    }
+    if (!advance(monitor, 0))
+    {
+        return CANCELLED;
+    }
+    if (size % 3 != 0)
+    {
+        return solveAmbiguous(board, size, presses, rowDeficits, colDeficits, monitor);
+    }
+
+    int rowStack[STACK_LINES];
+    int colStack[STACK_LINES];
+    std::vector<int> heapLines;
+    int *rows = rowStack;
+    int *cols = colStack;
+    if (size > STACK_LINES)
+    {
+        heapLines.resize(2 * static_cast<std::size_t>(size));
+        rows = heapLines.data();
+        cols = heapLines.data() + size;
+    }
+
+    int total = 0;
+    for (int a = 0; a < size; ++a)
+    {
+        total += rowDeficits[a];
+    }
+
+    // Total presses S satisfy (1 - 2N) * S = -T, then every row total is (S - T[a]) / (1 - N), same for columns.
+    int pressTotal = mod9(-total * INVERSE_MOD_9[mod9(1 - 2 * size)]);
+    int lineInverse = INVERSE_MOD_9[mod9(1 - size)];
+    for (int i = 0; i < size; ++i)
+    {
+        rows[i] = mod9((pressTotal - rowDeficits[i]) * lineInverse);
+        cols[i] = mod9((pressTotal - colDeficits[i]) * lineInverse);
+    }
+
+    // A cell must be pressed R[a] + C[b] - deficit times, because its own presses are counted in both totals.
+    int distance = 0;
+    for (int a = 0; a < size; ++a)
+    {
+        for (int b = 0; b < size; ++b)
+        {
+            int count = mod9(rows[a] + cols[b] - deficit(board[a * size + b]));
+            presses[a * size + b] = count;
+            distance += count;
+        }
+    }
+    advance(monitor, 100);
+    return distance;
+}
+
+int Solver::solveAmbiguous(const int *board, int size, int *presses, const int *rowDeficits, const int *colDeficits, Monitor *monitor)
+{
+    std::size_t cells = static_cast<std::size_t>(size) * size;
+    std::vector<int> deficits(cells);
+    for (std::size_t i = 0; i < cells; ++i)
+    {
+        deficits[i] = deficit(board[i]);
+    }
+    int total = 0;
+    for (int a = 0; a < size; ++a)
+    {
+        total += rowDeficits[a];
+    }
+
+    int totalBase, totalStep;
+    if (!solveLinear(1 - 2 * size, -total, totalBase, totalStep))
+    {
+        return -1;
+    }
+
+    bool exhaustive = searchCost(size) >= 0;
+    int best = -1;
+    std::vector<int> bestRows, bestCols, rows, cols;
+    std::vector<int> rowBase(size), colBase(size);
+    int candidates = (9 - totalBase + totalStep - 1) / totalStep; // Press totals to try, each gets an equal share of the progress.
+    for (int pressTotal = totalBase, index = 0; pressTotal < 9; pressTotal += totalStep, ++index)
+    {
+        // Row and column totals allowed by this press total.
+        bool solvable = true;
+        int step = 9;
+        for (int i = 0; i < size && solvable; ++i)
+        {
+            solvable = solveLinear(1 - size, pressTotal - rowDeficits[i], rowBase[i], step) &&
+                       solveLinear(1 - size, pressTotal - colDeficits[i], colBase[i], step);
+        }
+        if (!solvable)
+            continue;
+
+        int from = 100 * index / candidates;
+        int to = 100 * (index + 1) / candidates;
+        int cost = exhaustive ? searchRows(deficits, size, rowBase, colBase, step, pressTotal, rows, cols, monitor, from, to)
+                              : refineRows(deficits, size, rowBase, colBase, step, pressTotal, rows, cols, monitor, from, to);
+        if (cost == CANCELLED)
+        {
+            return CANCELLED;
+        }
+        if (cost >= 0 && (best < 0 || cost < best))
+        {
+            best = cost;
+            bestRows = rows;
+            bestCols = cols;
+        }
+    }
+    if (best < 0)
+    {
+        return -1;
+    }
+
+    for (int a = 0; a < size; ++a)
+    {
+        for (int b = 0; b < size; ++b)
+        {
+            presses[a * size + b] = mod9(bestRows[a] + bestCols[b] - deficits[a * size + b]);
+        }
+    }
+    advance(monitor, 100);
+    return best;
+}
+
+bool Solver::isExact(int size)
+{
+    return size % 3 != 1 || searchCost(size) >= 0;
+}
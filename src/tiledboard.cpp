@@ -0,0 +1,161 @@
+/**
+ * @file tiledboard.cpp
+ * @brief Implementation of TiledBoard class methods.
+ *
+ * A move adds a mask to every tile its row and column cross. The mask holds
+ * the press count at the cells of the move's row or column inside the tile,
+ * cut at the board's edge in the last tile of a line, and both in the tile
+ * where they cross, whose crossing cell is pressed once. Rows and columns go
+ * through the same vector kernel, see maskkernel.hpp.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "tiledboard.hpp"
+
+#include "maskkernel.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    constexpr int TILE_CELLS = TiledBoard::TILE_SIZE * TiledBoard::TILE_SIZE;
+    constexpr int PREFETCH_TILES = 8; // Tiles requested ahead along a line, boards larger than L2 wait on memory otherwise.
+
+    inline void prefetchTile(const void *tile)
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(tile, 1);
+#elif defined(MASKKERNEL_AVX2) || defined(MASKKERNEL_SSE2)
+        _mm_prefetch(static_cast<const char *>(tile), _MM_HINT_T0);
+#endif
+    }
+
+    // Add a mask to all cells of a tile, return the change of the number of cells not equal to 9.
+    inline int addTile(unsigned char *cells, const unsigned char *mask)
+    {
+        int change = 0;
+        for (std::size_t offset = 0; offset < TILE_CELLS; offset += MASK_VECTOR_BYTES)
+        {
+            change += addMask(cells + offset, mask + offset);
+        }
+        return change;
+    }
+}
+
+TiledBoard::TiledBoard() : size(0), lineTiles(0), blocks(0) {}
+
+void TiledBoard::reset(int size)
+{
+    this->size = size;
+    lineTiles = (size + TILE_SIZE - 1) / TILE_SIZE;
+    blocks = (lineTiles + BLOCK_TILES - 1) / BLOCK_TILES;
+    Tile nines;
+    std::memset(nines.cells, 9, sizeof(nines.cells));
+    tiles.assign(static_cast<std::size_t>(blocks) * blocks * BLOCK_TILES * BLOCK_TILES, nines);
+}
+
+void TiledBoard::assign(const int *values, int size)
+{
+    reset(size);
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            tiles[tileIndex(row / TILE_SIZE, col / TILE_SIZE)].cells[row % TILE_SIZE * TILE_SIZE + col % TILE_SIZE] =
+                static_cast<unsigned char>(values[row * size + col]);
+        }
+    }
+}
+
+void TiledBoard::copyTo(int *values) const
+{
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            values[row * size + col] = value(row, col);
+        }
+    }
+}
+
+int TiledBoard::increment(int row, int col)
+{
+    return press(row, col, 1);
+}
+
+int TiledBoard::decrement(int row, int col)
+{
+    return press(row, col, 8); // Eight presses undo one, 9 presses change nothing.
+}
+
+int TiledBoard::press(int row, int col, unsigned char presses)
+{
+    const int tileRow = row / TILE_SIZE;
+    const int tileCol = col / TILE_SIZE;
+    const int lastTile = lineTiles - 1;
+    const int lastCells = size - lastTile * TILE_SIZE; // Cells of a line in its last tile.
+
+    // Row and column inside a tile, whole or cut at the edge.
+    alignas(64) unsigned char rowMask[TILE_CELLS] = {};
+    alignas(64) unsigned char lastRowMask[TILE_CELLS] = {};
+    alignas(64) unsigned char colMask[TILE_CELLS] = {};
+    alignas(64) unsigned char lastColMask[TILE_CELLS] = {};
+    for (int i = 0; i < TILE_SIZE; ++i)
+    {
+        rowMask[row % TILE_SIZE * TILE_SIZE + i] = presses;
+        colMask[i * TILE_SIZE + col % TILE_SIZE] = presses;
+        if (i < lastCells)
+        {
+            lastRowMask[row % TILE_SIZE * TILE_SIZE + i] = presses;
+            lastColMask[i * TILE_SIZE + col % TILE_SIZE] = presses;
+        }
+    }
+
+    int change = 0;
+    for (int tile = 0; tile < lineTiles; ++tile)
+    {
+        if (tile + PREFETCH_TILES < lineTiles)
+        {
+            prefetchTile(&tiles[tileIndex(tileRow, tile + PREFETCH_TILES)]);
+        }
+        if (tile != tileCol)
+        {
+            change += addTile(tiles[tileIndex(tileRow, tile)].cells, tile == lastTile ? lastRowMask : rowMask);
+        }
+    }
+    for (int tile = 0; tile < lineTiles; ++tile)
+    {
+        if (tile + PREFETCH_TILES < lineTiles)
+        {
+            prefetchTile(&tiles[tileIndex(tile + PREFETCH_TILES, tileCol)]);
+        }
+        if (tile != tileRow)
+        {
+            change += addTile(tiles[tileIndex(tile, tileCol)].cells, tile == lastTile ? lastColMask : colMask);
+        }
+    }
+
+    const unsigned char *rowPart = tileCol == lastTile ? lastRowMask : rowMask;
+    const unsigned char *colPart = tileRow == lastTile ? lastColMask : colMask;
+    alignas(64) unsigned char crossMask[TILE_CELLS];
+    for (int i = 0; i < TILE_CELLS; ++i)
+    {
+        crossMask[i] = rowPart[i] | colPart[i]; // The crossing cell is pressed once.
+    }
+    return change + addTile(tiles[tileIndex(tileRow, tileCol)].cells, crossMask);
+}
+
+bool TiledBoard::isSolved() const
+{
+    return std::all_of(tiles.begin(), tiles.end(), [](const Tile &tile)
+                       { return std::all_of(tile.cells, tile.cells + TILE_CELLS, [](unsigned char value)
+                                            { return value == 9; }); });
+}
+
+std::size_t TiledBoard::bytes() const
+{
+    return tiles.size() * sizeof(Tile);
+}
@@ -0,0 +1,129 @@
+#include "batchenvironment.hpp"
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Play the same random moves on a batch and on one GameLogic per board, comparing every step.
+static void compareWithGames(int size, int boards, int difficulty, int steps, GameRandom::Engine engine)
+{
+    BatchEnvironment batch(boards, size, difficulty);
+    batch.setRandomStream(7, engine);
+    std::vector<uint64_t> seeds(boards);
+    std::vector<std::unique_ptr<GameLogic>> games;
+    for (int b = 0; b < boards; ++b)
+    {
+        seeds[b] = 1000 + b;
+        games.push_back(std::make_unique<GameLogic>(size));
+        games[b]->setRandomStream(7, engine);
+        games[b]->setDifficulty(difficulty);
+        games[b]->setSeed(seeds[b]);
+        games[b]->init();
+    }
+    batch.reset(seeds.data());
+
+    std::mt19937 random(size);
+    std::uniform_int_distribution<int> cell(-1, size * size - 1);
+    std::vector<int> actions(boards);
+    std::vector<float> rewards(boards);
+    std::vector<unsigned char> done(boards);
+    const int cells = size * size;
+    for (int step = 0; step <= steps; ++step)
+    {
+        for (int b = 0; b < boards; ++b)
+        {
+            const unsigned char *observation = batch.observations() + b * cells;
+            for (int i = 0; i < cells; ++i)
+            {
+                ASSERT_EQ(observation[i], games[b]->getBoardValue({i / size, i % size}))
+                    << "size " << size << ", board " << b << ", step " << step << ", cell " << i;
+            }
+            ASSERT_EQ(batch.isWin(b), games[b]->isWin());
+            ASSERT_EQ(batch.getNumMoves(b), games[b]->getNumMoves());
+        }
+        if (step == steps)
+        {
+            break;
+        }
+
+        for (int b = 0; b < boards; ++b)
+        {
+            actions[b] = cell(random);
+            if (!games[b]->isWin() && actions[b] >= 0)
+            {
+                games[b]->makeMove({actions[b] / size, actions[b] % size});
+            }
+        }
+        batch.step(actions.data(), rewards.data(), done.data());
+        for (int b = 0; b < boards; ++b)
+        {
+            EXPECT_EQ(done[b] != 0, games[b]->isWin());
+        }
+    }
+}
+
+TEST(BatchEnvironmentTest, TestMatchesGameLogic)
+{
+    for (int size : {1, 2, 3, 4, 5, 6, 8, 9, 12, 16, 17, 20}) // Sizes above VECTOR_MAX_SIZE step line by line.
+    {
+        compareWithGames(size, 17, size * size / 2 + 1, 300, GameRandom::Engine::Xoshiro);
+    }
+    compareWithGames(4, 5, 6, 100, GameRandom::Engine::Philox);
+}
+
+TEST(BatchEnvironmentTest, TestWinRewardAndDone)
+{
+    // Pressing the cells of the generated board's solution wins it, the winning step gets the reward.
+    GameLogic game(3);
+    game.setDifficulty(1);
+    game.setSeed(5);
+    game.init();
+    GameLogic::Move hint = game.hintNextMove();
+
+    BatchEnvironment batch(2, 3, 1);
+    uint64_t seeds[] = {5, 5};
+    batch.reset(seeds);
+    int actions[] = {hint.row * 3 + hint.col, -1};
+    float rewards[2];
+    unsigned char done[2];
+    batch.step(actions, rewards, done);
+    EXPECT_EQ(rewards[0], BatchEnvironment::WIN_REWARD);
+    EXPECT_EQ(rewards[1], 0.0f);
+    EXPECT_EQ(done[0], 1);
+    EXPECT_EQ(done[1], 0);
+    EXPECT_EQ(batch.getNumMoves(1), 0); // A negative action skips the board.
+
+    // A done board ignores further moves until it is reset.
+    batch.step(actions, rewards, done);
+    EXPECT_EQ(rewards[0], 0.0f);
+    EXPECT_EQ(batch.getNumMoves(0), 1);
+    batch.reset(0, 5);
+    EXPECT_FALSE(batch.isWin(0));
+    EXPECT_EQ(batch.getNumMoves(0), 0);
+}
+
+TEST(BatchEnvironmentTest, TestMoveLimitAndErrors)
+{
+    BatchEnvironment batch(1, 4, 3, 2);
+    uint64_t seed = 9;
+    batch.reset(&seed);
+    int action = 0;
+    float reward;
+    unsigned char done;
+    batch.step(&action, &reward, &done);
+    EXPECT_EQ(done, 0);
+    batch.step(&action, &reward, &done);
+    EXPECT_EQ(done, 1); // Two moves on one cell do not win the board, but reach the limit.
+    EXPECT_FALSE(batch.isWin(0));
+
+    batch.reset(0, 9);
+    std::vector<unsigned char> before(batch.observations(), batch.observations() + 16);
+    action = 16;
+    EXPECT_THROW(batch.step(&action, &reward, &done), std::out_of_range);
+    EXPECT_EQ(std::vector<unsigned char>(batch.observations(), batch.observations() + 16), before);
+    EXPECT_THROW(batch.reset(1, 0), std::out_of_range);
+    EXPECT_THROW(BatchEnvironment(0, 3), std::out_of_range);
+    EXPECT_THROW(BatchEnvironment(1, 3, 10), std::out_of_range);
+}
@@ -0,0 +1,156 @@
+#include "boardhash.hpp"
+#include "boardsymmetry.hpp"
+#include "gamelogic.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Random transform of a board of given size.
+static BoardSymmetry::Transform randomTransform(int size, std::mt19937 &gen)
+{
+    BoardSymmetry::Transform transform;
+    transform.transposed = gen() % 2 == 1;
+    transform.rows.resize(size);
+    transform.cols.resize(size);
+    std::iota(transform.rows.begin(), transform.rows.end(), 0);
+    std::iota(transform.cols.begin(), transform.cols.end(), 0);
+    std::shuffle(transform.rows.begin(), transform.rows.end(), gen);
+    std::shuffle(transform.cols.begin(), transform.cols.end(), gen);
+    return transform;
+}
+
+// Random board with values in [1, 9], or in [8, 9] so rows and columns often tie.
+static std::vector<int> randomBoard(int size, std::mt19937 &gen, bool ties)
+{
+    std::uniform_int_distribution<> value(ties ? 8 : 1, 9);
+    std::vector<int> board(static_cast<std::size_t>(size) * size);
+    for (int &cell : board)
+    {
+        cell = value(gen);
+    }
+    return board;
+}
+
+TEST(BoardSymmetryTest, TestEquivalentBoardsShareCanonicalForm)
+{
+    std::mt19937 gen(24);
+    for (int size = 1; size <= BoardSymmetry::MAX_CANONICAL_SIZE; ++size)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            std::vector<int> board = randomBoard(size, gen, i % 2 == 1);
+            BoardSymmetry::Canonical canonical = BoardSymmetry::canonicalize(board.data(), size);
+            std::vector<int> transformed(board.size());
+            BoardSymmetry::apply(canonical.transform, board.data(), transformed.data());
+            ASSERT_EQ(transformed, canonical.values);
+            ASSERT_EQ(canonical.key, hashBoard(canonical.values.data(), size));
+
+            BoardSymmetry::apply(randomTransform(size, gen), board.data(), transformed.data());
+            BoardSymmetry::Canonical other = BoardSymmetry::canonicalize(transformed.data(), size);
+            ASSERT_EQ(other.values, canonical.values) << "size " << size << ", board " << i;
+            ASSERT_EQ(other.key, canonical.key);
+        }
+    }
+}
+
+// The canonical form is the smallest of all forms, checked against every transform of 3x3 and 4x4 boards.
+TEST(BoardSymmetryTest, TestSmallestOfAllForms)
+{
+    std::mt19937 gen(3);
+    for (int size : {3, 4})
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            std::vector<int> board = randomBoard(size, gen, i % 2 == 1);
+            std::vector<int> smallest;
+            std::vector<int> form(board.size());
+            BoardSymmetry::Transform transform;
+            transform.rows.resize(size);
+            for (int transposed = 0; transposed < 2; ++transposed)
+            {
+                transform.transposed = transposed == 1;
+                std::iota(transform.rows.begin(), transform.rows.end(), 0);
+                do
+                {
+                    transform.cols = transform.rows;
+                    std::sort(transform.cols.begin(), transform.cols.end());
+                    do
+                    {
+                        BoardSymmetry::apply(transform, board.data(), form.data());
+                        if (smallest.empty() || form < smallest)
+                        {
+                            smallest = form;
+                        }
+                    } while (std::next_permutation(transform.cols.begin(), transform.cols.end()));
+                } while (std::next_permutation(transform.rows.begin(), transform.rows.end()));
+            }
+            EXPECT_EQ(BoardSymmetry::canonicalize(board.data(), size).values, smallest);
+        }
+    }
+}
+
+TEST(BoardSymmetryTest, TestMovesMapToCanonicalForm)
+{
+    std::mt19937 gen(11);
+    GameLogic game(5);
+    game.setDifficulty(9);
+    game.init();
+    BoardSymmetry::Canonical canonical = BoardSymmetry::canonicalize(game);
+    GameLogic mirror(5);
+    mirror.setBoard(canonical.values.data());
+    EXPECT_EQ(mirror.getOptimalDistance(), game.getOptimalDistance());
+
+    std::uniform_int_distribution<> line(0, 4);
+    for (int i = 0; i < 50; ++i)
+    {
+        GameLogic::Move move = {line(gen), line(gen)};
+        GameLogic::Move mapped = BoardSymmetry::toCanonical(canonical.transform, move);
+        GameLogic::Move back = BoardSymmetry::fromCanonical(canonical.transform, mapped);
+        ASSERT_EQ(back.row, move.row);
+        ASSERT_EQ(back.col, move.col);
+        game.makeMove(move);
+        mirror.makeMove(mapped);
+        std::vector<int> values(25);
+        for (int cell = 0; cell < 25; ++cell)
+        {
+            values[cell] = game.getBoardValue({cell / 5, cell % 5});
+        }
+        std::vector<int> transformed(25);
+        BoardSymmetry::apply(canonical.transform, values.data(), transformed.data());
+        for (int cell = 0; cell < 25; ++cell)
+        {
+            ASSERT_EQ(mirror.getBoardValue({cell / 5, cell % 5}), transformed[cell]);
+        }
+    }
+}
+
+TEST(BoardSymmetryTest, TestSymmetricBoards)
+{
+    // Every row and column of a cyclic board holds the same values, so the search ties at every step.
+    const int size = BoardSymmetry::MAX_CANONICAL_SIZE;
+    std::vector<int> cyclic(size * size);
+    std::vector<int> shifted(size * size);
+    for (int row = 0; row < size; ++row)
+    {
+        for (int col = 0; col < size; ++col)
+        {
+            cyclic[row * size + col] = (row + col) % size + 1;
+            shifted[row * size + col] = (row + col + 3) % size + 1;
+        }
+    }
+    EXPECT_EQ(BoardSymmetry::canonicalize(cyclic.data(), size).values, BoardSymmetry::canonicalize(shifted.data(), size).values);
+
+    std::vector<int> won(size * size, 9);
+    BoardSymmetry::Canonical canonical = BoardSymmetry::canonicalize(won.data(), size);
+    EXPECT_EQ(canonical.values, won);
+    EXPECT_EQ(canonical.key, GameLogic(size).stateHash());
+}
+
+TEST(BoardSymmetryTest, TestInvalidSize)
+{
+    std::vector<int> board(81, 9);
+    EXPECT_THROW(BoardSymmetry::canonicalize(board.data(), 9), std::out_of_range);
+    EXPECT_THROW(BoardSymmetry::canonicalize(GameLogic(9)), std::out_of_range);
+}
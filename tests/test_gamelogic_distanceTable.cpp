@@ -0,0 +1,196 @@
+#include "gamelogic.hpp"
+#include "distancetable.hpp"
+#include "mappedfile.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Board with the given table index.
+static void boardOfIndex(uint64_t index, int *board)
+{
+    for (int cell = 0; cell < 9; ++cell)
+    {
+        int digit = static_cast<int>(index % 9);
+        board[cell] = digit == 0 ? 9 : digit;
+        index /= 9;
+    }
+}
+
+// Table file with a valid header and all entries zero. The file is sparse, only written entries take space.
+static std::string createTable(MappedFile &file, const char *name)
+{
+    std::string path = ::testing::TempDir() + name;
+    EXPECT_TRUE(file.create(path, DistanceTable::HEADER_BYTES + DistanceTable::STATES));
+    uint32_t header[4] = {DistanceTable::MAGIC, DistanceTable::VERSION, DistanceTable::SIZE, 8};
+    uint64_t states = DistanceTable::STATES;
+    std::memcpy(file.data(), header, sizeof(header));
+    std::memcpy(file.data() + sizeof(header), &states, sizeof(states));
+    return path;
+}
+
+// Write the entries of a board and of the 9 boards one move away.
+static void writeNeighbourhood(MappedFile &file, const int *board)
+{
+    unsigned char *entries = file.data() + DistanceTable::HEADER_BYTES;
+    uint32_t index = DistanceTable::index(board);
+    DistanceTable::fill(entries + index, index, index + 1);
+    for (int move = 0; move < 9; ++move)
+    {
+        int next[9];
+        for (int cell = 0; cell < 9; ++cell)
+        {
+            bool hit = cell / 3 == move / 3 || cell % 3 == move % 3;
+            next[cell] = hit ? board[cell] % 9 + 1 : board[cell];
+        }
+        index = DistanceTable::index(next);
+        DistanceTable::fill(entries + index, index, index + 1);
+    }
+}
+
+TEST(DistanceTableTest, TestIndex)
+{
+    int won[9] = {9, 9, 9, 9, 9, 9, 9, 9, 9};
+    int last[9] = {8, 8, 8, 8, 8, 8, 8, 8, 8};
+    EXPECT_EQ(DistanceTable::index(won), 0u);
+    EXPECT_EQ(DistanceTable::index(last), DistanceTable::STATES - 1);
+
+    int board[9];
+    boardOfIndex(123456789, board);
+    EXPECT_EQ(DistanceTable::index(board), 123456789u);
+}
+
+TEST(DistanceTableTest, TestFillMatchesSolver)
+{
+    // A range long enough to carry into the fifth digit, starting in the middle of the table.
+    const uint64_t begin = 200000000;
+    const uint64_t count = 70000;
+    std::vector<unsigned char> entries(count);
+    DistanceTable::fill(entries.data(), begin, begin + count);
+    for (uint64_t i = 0; i < count; i += 7)
+    {
+        int board[9];
+        int presses[9];
+        boardOfIndex(begin + i, board);
+        ASSERT_EQ(entries[i], Solver::solve(board, 3, presses)) << "index " << begin + i;
+    }
+
+    // Single entries anywhere in the table.
+    std::mt19937 gen(4);
+    std::uniform_int_distribution<uint64_t> distrib(0, DistanceTable::STATES - 1);
+    for (int i = 0; i < 2000; ++i)
+    {
+        uint64_t index = distrib(gen);
+        unsigned char entry;
+        int board[9];
+        int presses[9];
+        DistanceTable::fill(&entry, index, index + 1);
+        boardOfIndex(index, board);
+        ASSERT_EQ(entry, Solver::solve(board, 3, presses)) << "index " << index;
+    }
+}
+
+TEST(DistanceTableTest, TestMissingFileFallsBackToSolver)
+{
+    DistanceTable table(::testing::TempDir() + "target9_missing.tbl");
+    int board[9] = {8, 8, 9, 9, 9, 9, 9, 9, 9};
+    int presses[9];
+    EXPECT_FALSE(table.isLoaded());
+    EXPECT_EQ(table.distance(board), Solver::solve(board, 3, presses));
+    EXPECT_GE(table.bestMove(board), 0);
+
+    int won[9] = {9, 9, 9, 9, 9, 9, 9, 9, 9};
+    EXPECT_EQ(table.distance(won), 0);
+    EXPECT_EQ(table.bestMove(won), -1);
+}
+
+TEST(DistanceTableTest, TestInvalidHeaderFallsBackToSolver)
+{
+    MappedFile file;
+    std::string path = createTable(file, "target9_invalid.tbl");
+    uint32_t version = DistanceTable::VERSION + 1;
+    std::memcpy(file.data() + 4, &version, sizeof(version));
+    file.close();
+
+    DistanceTable table(path);
+    int board[9] = {1, 9, 9, 9, 9, 9, 9, 9, 9};
+    int presses[9];
+    EXPECT_FALSE(table.isLoaded());
+    EXPECT_EQ(table.distance(board), Solver::solve(board, 3, presses));
+    std::remove(path.c_str());
+}
+
+TEST(DistanceTableTest, TestLookupComesFromFile)
+{
+    MappedFile file;
+    std::string path = createTable(file, "target9_lookup.tbl");
+    int board[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    file.data()[DistanceTable::HEADER_BYTES + DistanceTable::index(board)] = 42; // Not the real distance.
+    file.close();
+
+    DistanceTable table(path);
+    EXPECT_TRUE(table.isLoaded());
+    EXPECT_EQ(table.distance(board), 42);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestHintsFromDistanceTable)
+{
+    MappedFile file;
+    std::string path = createTable(file, "target9_hints.tbl");
+    auto table = std::make_shared<DistanceTable>(path);
+    gameLogic.setDistanceTable(table);
+
+    for (int difficulty = 1; difficulty <= 9; ++difficulty)
+    {
+        gameLogic.setDifficulty(difficulty);
+        gameLogic.init();
+        int board[9];
+        int presses[9];
+        for (int cell = 0; cell < 9; ++cell)
+        {
+            board[cell] = gameLogic.getBoardValue({cell / 3, cell % 3});
+        }
+        int distance = Solver::solve(board, 3, presses);
+        int moves = 0;
+        while (!gameLogic.isWin())
+        {
+            for (int cell = 0; cell < 9; ++cell)
+            {
+                board[cell] = gameLogic.getBoardValue({cell / 3, cell % 3});
+            }
+            writeNeighbourhood(file, board); // Table is written through a second mapping of the same file.
+            ASSERT_EQ(gameLogic.getOptimalDistance(), distance - moves);
+            gameLogic.makeMove(gameLogic.hintNextMove());
+            ++moves;
+            ASSERT_LE(moves, distance);
+        }
+        EXPECT_EQ(moves, distance);
+        EXPECT_TRUE(table->isLoaded());
+    }
+    file.close();
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestPackedHintsWithMissingTable)
+{
+    gameLogic.setDistanceTable(std::make_shared<DistanceTable>(::testing::TempDir() + "target9_missing.tbl"));
+    gameLogic.setStorage(GameLogic::Storage::Packed);
+    gameLogic.setDifficulty(6);
+    gameLogic.init();
+    int distance = gameLogic.getOptimalDistance();
+    int moves = 0;
+    while (!gameLogic.isWin())
+    {
+        gameLogic.makeMove(gameLogic.hintNextMove());
+        ++moves;
+    }
+    EXPECT_EQ(moves, distance);
+}
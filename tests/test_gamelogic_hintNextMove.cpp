@@ -0,0 +1,81 @@
+#include "gamelogic.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+TEST_F(GameLogicTest, TestHintNotAllowed)
+{
+    // Hint is not allowed before the game is initialized.
+    EXPECT_THROW(gameLogic.hintNextMove(), std::runtime_error);
+}
+
+TEST_F(GameLogicTest, TestOptimalDistanceSingleMove)
+{
+    // Board is solved at the start.
+    EXPECT_EQ(gameLogic.getOptimalDistance(), 0);
+
+    // Cell can only be incremented, so one move is undone by pressing the same cell 8 more times.
+    gameLogic.makeMove({1, 2});
+    EXPECT_EQ(gameLogic.getOptimalDistance(), 8);
+}
+
+TEST_F(GameLogicTest, TestSolverMatchesPressCounts)
+{
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<> distrib(0, DEFAULT_SIZE - 1);
+    for (int round = 0; round < 200; ++round)
+    {
+        GameLogic game;
+        int counts[DEFAULT_SIZE * DEFAULT_SIZE] = {};
+        for (int i = 0; i < round % 40; ++i)
+        {
+            GameLogic::Move move = {distrib(gen), distrib(gen)};
+            game.makeMove(move);
+            ++counts[move.row * DEFAULT_SIZE + move.col];
+        }
+
+        // The only solution presses every cell until its count is a multiple of 9.
+        int board[DEFAULT_SIZE * DEFAULT_SIZE];
+        int expectedDistance = 0;
+        for (int i = 0; i < DEFAULT_SIZE; ++i)
+        {
+            for (int j = 0; j < DEFAULT_SIZE; ++j)
+            {
+                board[i * DEFAULT_SIZE + j] = game.getBoardValue({i, j});
+                expectedDistance += (9 - counts[i * DEFAULT_SIZE + j] % 9) % 9;
+            }
+        }
+        int presses[DEFAULT_SIZE * DEFAULT_SIZE];
+        EXPECT_EQ(Solver::solve(board, DEFAULT_SIZE, presses), expectedDistance);
+        for (int i = 0; i < DEFAULT_SIZE * DEFAULT_SIZE; ++i)
+        {
+            EXPECT_EQ(presses[i], (9 - counts[i] % 9) % 9);
+        }
+        EXPECT_EQ(game.getOptimalDistance(), expectedDistance);
+    }
+}
+
+TEST_F(GameLogicTest, TestHintReachesWinInOptimalMoves)
+{
+    for (int difficulty = 1; difficulty <= DEFAULT_SIZE * DEFAULT_SIZE; ++difficulty)
+    {
+        gameLogic.setDifficulty(difficulty);
+        gameLogic.init();
+        int distance = gameLogic.getOptimalDistance();
+
+        // Every hinted move must bring the player exactly one move closer to the win.
+        for (int left = distance; left > 0; --left)
+        {
+            ASSERT_FALSE(gameLogic.isWin());
+            gameLogic.makeMove(gameLogic.hintNextMove());
+            ASSERT_EQ(gameLogic.getOptimalDistance(), left - 1);
+        }
+        EXPECT_TRUE(gameLogic.isWin());
+    }
+}
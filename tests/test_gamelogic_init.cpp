@@ -0,0 +1,81 @@
+#include "gamelogic.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+TEST_F(GameLogicTest, TestInitDistanceEqualsDifficulty)
+{
+    for (int difficulty = 1; difficulty <= 9; ++difficulty)
+    {
+        gameLogic.setDifficulty(difficulty);
+        for (int i = 0; i < 200; ++i)
+        {
+            gameLogic.init();
+            ASSERT_EQ(gameLogic.getOptimalDistance(), difficulty) << "difficulty " << difficulty;
+            ASSERT_FALSE(gameLogic.isWin());
+            ASSERT_EQ(gameLogic.getNumMoves(), 0);
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestInitDistanceAllSizes)
+{
+    // Every size the solver is exact for, every difficulty.
+    for (int size = 1; size <= 12; ++size)
+    {
+        if (!Solver::isExact(size))
+        {
+            continue;
+        }
+        for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                           GameLogic::Storage::Lazy})
+        {
+            GameLogic game(size);
+            game.setStorage(storage);
+            for (int difficulty = 1; difficulty <= size * size; ++difficulty)
+            {
+                game.setDifficulty(difficulty);
+                for (int i = 0; i < 5; ++i)
+                {
+                    game.init();
+                    ASSERT_EQ(game.getOptimalDistance(), difficulty) << "size " << size << ", difficulty " << difficulty;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestInitOtherSizesNotWon)
+{
+    // Sizes the solver is not exact for still never start won.
+    for (int size : {10, 13, 16})
+    {
+        GameLogic game(size);
+        for (int difficulty : {1, size, size * size})
+        {
+            game.setDifficulty(difficulty);
+            game.init();
+            ASSERT_FALSE(game.isWin()) << "size " << size << ", difficulty " << difficulty;
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestInitHintsWinInDifficultyMoves)
+{
+    gameLogic.setSize(5);
+    gameLogic.setDifficulty(25);
+    gameLogic.init();
+    int moves = 0;
+    while (!gameLogic.isWin())
+    {
+        gameLogic.makeMove(gameLogic.hintNextMove());
+        ++moves;
+        ASSERT_LE(moves, 25);
+    }
+    EXPECT_EQ(moves, 25);
+}
@@ -0,0 +1,123 @@
+#include "boardkernel.hpp"
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Win condition by scanning every cell.
+static bool allNines(const GameLogic &game)
+{
+    for (int i = 0; i < game.getSize(); ++i)
+    {
+        for (int j = 0; j < game.getSize(); ++j)
+        {
+            if (game.getBoardValue({i, j}) != 9)
+                return false;
+        }
+    }
+    return true;
+}
+
+TEST_F(GameLogicTest, TestIsWinAfterFullCycle)
+{
+    EXPECT_TRUE(gameLogic.isWin());
+    for (int i = 0; i < 8; ++i)
+    {
+        gameLogic.makeMove({1, 2});
+        EXPECT_FALSE(gameLogic.isWin());
+    }
+    gameLogic.makeMove({1, 2}); // Nine presses bring every value back to 9.
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_F(GameLogicTest, TestIsWinAfterUndoRedoSeek)
+{
+    gameLogic.makeMove({0, 0});
+    EXPECT_FALSE(gameLogic.isWin());
+    gameLogic.undoMove();
+    gameLogic.redoMove();
+    EXPECT_FALSE(gameLogic.isWin());
+    gameLogic.seekTo(0);
+    EXPECT_TRUE(gameLogic.isWin());
+    gameLogic.seekTo(1);
+    EXPECT_FALSE(gameLogic.isWin());
+    gameLogic.undoMove();
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_F(GameLogicTest, TestIsWinAfterInitAndSetSize)
+{
+    gameLogic.setDifficulty(5);
+    gameLogic.init();
+    EXPECT_FALSE(gameLogic.isWin());
+    gameLogic.setSize(4);
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_F(GameLogicTest, TestIsWinMatchesScanOnRandomPlay)
+{
+    std::mt19937 gen(11);
+    for (int size : {3, 5, 8, 17, 20})
+    {
+        for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                           GameLogic::Storage::Lazy})
+        {
+            GameLogic game(size);
+            game.setStorage(storage);
+            std::uniform_int_distribution<> cell(0, size - 1);
+            std::uniform_int_distribution<> action(0, 9);
+            for (int step = 0; step < 2000; ++step)
+            {
+                int choice = action(gen);
+                if (choice == 0 && game.getNumMoves() > 0)
+                {
+                    game.seekTo(game.getNumMoves() / 2);
+                }
+                else if (choice <= 2 && game.isCanUndo())
+                {
+                    game.undoMove();
+                }
+                else if (choice == 3 && game.isCanRedo())
+                {
+                    game.redoMove();
+                }
+                else if (choice == 4)
+                {
+                    std::vector<GameLogic::Move> moves(size + 1, {cell(gen), cell(gen)});
+                    game.makeMoves(moves);
+                }
+                else
+                {
+                    game.makeMove({cell(gen), cell(gen)});
+                }
+                ASSERT_EQ(game.isWin(), allNines(game)) << "size " << size << ", step " << step;
+            }
+        }
+    }
+}
+
+TEST(BoardKernelTest, TestKernelsCountChangedCells)
+{
+    for (int size : {3, 4, 5, 8, 11})
+    {
+        std::vector<int> board(size * size, 9);
+        int unsolved = visitBoardKernel(size, [&board](auto kernel)
+                                        { return kernel.increment(board.data(), 0, 0); });
+        EXPECT_EQ(unsolved, 2 * size - 1);
+        for (int i = 0; i < 8; ++i)
+        {
+            unsolved += visitBoardKernel(size, [&board](auto kernel)
+                                         { return kernel.increment(board.data(), 0, 0); });
+        }
+        EXPECT_EQ(unsolved, 0);
+        unsolved += visitBoardKernel(size, [&board, size](auto kernel)
+                                     { return kernel.decrement(board.data(), size - 1, 1); });
+        EXPECT_EQ(unsolved, 2 * size - 1);
+    }
+}
@@ -0,0 +1,126 @@
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Check that both games show the same board and history state.
+static void expectSameGame(const GameLogic &batch, const GameLogic &single)
+{
+    ASSERT_EQ(batch.getNumMoves(), single.getNumMoves());
+    ASSERT_EQ(batch.getHistorySize(), single.getHistorySize());
+    ASSERT_EQ(batch.isCanUndo(), single.isCanUndo());
+    ASSERT_EQ(batch.isCanRedo(), single.isCanRedo());
+    for (int i = 0; i < batch.getSize(); ++i)
+    {
+        for (int j = 0; j < batch.getSize(); ++j)
+        {
+            ASSERT_EQ(batch.getBoardValue({i, j}), single.getBoardValue({i, j})) << "cell " << i << ", " << j;
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestMakeMovesAllowed)
+{
+    gameLogic.makeMoves({{0, 1}, {0, 1}, {2, 2}, {1, 0}});
+    EXPECT_EQ(gameLogic.getNumMoves(), 4);
+    EXPECT_EQ(gameLogic.getBoardValue({0, 0}), 3);
+    EXPECT_EQ(gameLogic.getBoardValue({0, 1}), 2);
+    EXPECT_EQ(gameLogic.getBoardValue({1, 1}), 3);
+    EXPECT_EQ(gameLogic.getBoardValue({2, 2}), 1);
+    gameLogic.undoMove();
+    EXPECT_EQ(gameLogic.getBoardValue({1, 1}), 2);
+    gameLogic.undoMoves(3);
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_F(GameLogicTest, TestMakeMovesOutOfRange)
+{
+    gameLogic.makeMove({1, 1});
+    EXPECT_THROW(gameLogic.makeMoves({{0, 0}, {3, 0}}), std::out_of_range);
+    EXPECT_EQ(gameLogic.getNumMoves(), 1); // Nothing was played.
+    EXPECT_EQ(gameLogic.getBoardValue({0, 0}), 9);
+    EXPECT_THROW(gameLogic.undoMoves(2), std::runtime_error);
+    EXPECT_THROW(gameLogic.undoMoves(-1), std::runtime_error);
+}
+
+TEST_F(GameLogicTest, TestMakeMovesMatchesMakeMove)
+{
+    std::mt19937 gen(7);
+    for (int size : {1, 2, 3, 5, 8, 12})
+    {
+        for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                           GameLogic::Storage::Lazy})
+        {
+            GameLogic batch(size);
+            GameLogic single(size);
+            batch.setStorage(storage);
+            std::uniform_int_distribution<> cell(0, size - 1);
+            for (int count : {0, 1, 3, 20, 63, 64, 65, 500, 3000})
+            {
+                std::vector<GameLogic::Move> moves;
+                for (int i = 0; i < count; ++i)
+                {
+                    moves.push_back({cell(gen), cell(gen)});
+                    single.makeMove(moves.back());
+                }
+                batch.makeMoves(moves);
+                expectSameGame(batch, single);
+
+                // Undo part of it and check that redo and seeking use the same history.
+                int undo = count / 3;
+                batch.undoMoves(undo);
+                for (int i = 0; i < undo; ++i)
+                {
+                    single.undoMove();
+                }
+                expectSameGame(batch, single);
+                if (batch.isCanRedo())
+                {
+                    batch.redoMove();
+                    single.redoMove();
+                    expectSameGame(batch, single);
+                }
+            }
+            for (int index : {0, 1, 64, 65, 1000, single.getHistorySize()})
+            {
+                if (index <= single.getHistorySize())
+                {
+                    batch.seekTo(index);
+                    single.seekTo(index);
+                    expectSameGame(batch, single);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestMakeMovesAfterUndoDropsRedo)
+{
+    std::vector<GameLogic::Move> moves(200, GameLogic::Move{0, 0});
+    gameLogic.makeMoves(moves);
+    gameLogic.undoMoves(150);
+    EXPECT_TRUE(gameLogic.isCanRedo());
+    gameLogic.makeMoves(std::vector<GameLogic::Move>(100, GameLogic::Move{1, 2}));
+    EXPECT_FALSE(gameLogic.isCanRedo());
+    EXPECT_EQ(gameLogic.getHistorySize(), 150);
+
+    GameLogic expected;
+    for (int i = 0; i < 50; ++i)
+    {
+        expected.makeMove({0, 0});
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        expected.makeMove({1, 2});
+    }
+    expectSameGame(gameLogic, expected);
+    gameLogic.seekTo(70); // Checkpoint at 64 was written by the new batch.
+    expected.seekTo(70);
+    expectSameGame(gameLogic, expected);
+}
@@ -0,0 +1,101 @@
+#include "gamelogic.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Solve the board of a game from scratch.
+static std::vector<int> solveFromScratch(const GameLogic &game, int &distance)
+{
+    int size = game.getSize();
+    std::vector<int> cells(size * size), presses(size * size);
+    for (int i = 0; i < size; ++i)
+    {
+        for (int j = 0; j < size; ++j)
+        {
+            cells[i * size + j] = game.getBoardValue({i, j});
+        }
+    }
+    distance = Solver::solve(cells.data(), size, presses.data());
+    return presses;
+}
+
+TEST_F(GameLogicTest, TestScoreCellsWonBoard)
+{
+    EXPECT_EQ(gameLogic.scoreCells(), std::vector<int>(9, 0));
+}
+
+TEST_F(GameLogicTest, TestScoreCellsSingleMove)
+{
+    gameLogic.makeMove({1, 2});
+    std::vector<int> scores = gameLogic.scoreCells();
+    for (int cell = 0; cell < 9; ++cell)
+    {
+        EXPECT_EQ(scores[cell], cell == 5 ? 8 : 0) << "cell " << cell; // Eight more presses wrap the move around.
+    }
+    gameLogic.undoMove();
+    EXPECT_EQ(gameLogic.scoreCells(), std::vector<int>(9, 0));
+}
+
+TEST_F(GameLogicTest, TestScoreCellsMatchesSolverOnRandomPlay)
+{
+    std::mt19937 gen(12);
+    for (int size : {2, 3, 4, 5, 6, 9, 11, 12})
+    {
+        for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                           GameLogic::Storage::Lazy})
+        {
+            GameLogic game(size);
+            game.setStorage(storage);
+            game.setDifficulty(size);
+            game.init();
+            std::uniform_int_distribution<> cell(0, size - 1);
+            std::uniform_int_distribution<> action(0, 5);
+            for (int step = 0; step < 300; ++step)
+            {
+                int choice = action(gen);
+                if (choice == 0 && game.isCanUndo())
+                {
+                    game.undoMove();
+                }
+                else if (choice == 1 && game.isCanRedo())
+                {
+                    game.redoMove();
+                }
+                else if (choice == 2 && game.getNumMoves() > 0)
+                {
+                    game.seekTo(game.getNumMoves() - 1);
+                }
+                else
+                {
+                    game.makeMove({cell(gen), cell(gen)});
+                }
+                int distance;
+                std::vector<int> expected = solveFromScratch(game, distance);
+                ASSERT_EQ(game.getOptimalDistance(), distance) << "size " << size << ", step " << step;
+                ASSERT_EQ(game.scoreCells(), expected) << "size " << size << ", step " << step;
+            }
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestScoreCellsLargeBoard)
+{
+    GameLogic game(512);
+    game.setDifficulty(1000);
+    game.init();
+    std::vector<int> scores = game.scoreCells();
+    int total = 0;
+    for (int score : scores)
+    {
+        total += score;
+    }
+    EXPECT_EQ(total, game.getOptimalDistance());
+    EXPECT_LE(total, 1000);
+}
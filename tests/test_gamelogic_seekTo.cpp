@@ -0,0 +1,166 @@
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Check that the board equals the board after playing the first count moves on a won board.
+static void expectBoardAfter(const GameLogic &game, const std::vector<GameLogic::Move> &moves, int count)
+{
+    GameLogic expected(game.getSize());
+    for (int i = 0; i < count; ++i)
+    {
+        expected.makeMove(moves[i]);
+    }
+    for (int i = 0; i < game.getSize(); ++i)
+    {
+        for (int j = 0; j < game.getSize(); ++j)
+        {
+            ASSERT_EQ(game.getBoardValue({i, j}), expected.getBoardValue({i, j})) << "after " << count << " moves, cell " << i << ", " << j;
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestSeekToMatchesUndoRedo)
+{
+    gameLogic.makeMove({0, 1});
+    gameLogic.makeMove({2, 2});
+    gameLogic.makeMove({1, 0});
+    gameLogic.seekTo(1);
+    EXPECT_EQ(gameLogic.getNumMoves(), 1);
+    EXPECT_EQ(gameLogic.getHistorySize(), 3);
+    EXPECT_TRUE(gameLogic.isCanUndo());
+    EXPECT_TRUE(gameLogic.isCanRedo());
+    EXPECT_EQ(gameLogic.getBoardValue({0, 0}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({2, 2}), 9);
+
+    gameLogic.redoMove();
+    EXPECT_EQ(gameLogic.getBoardValue({2, 2}), 1);
+    gameLogic.seekTo(0);
+    EXPECT_FALSE(gameLogic.isCanUndo());
+    EXPECT_TRUE(gameLogic.isWin());
+    gameLogic.seekTo(3);
+    EXPECT_FALSE(gameLogic.isCanRedo());
+    EXPECT_EQ(gameLogic.getBoardValue({1, 1}), 2); // Crossed by the first and the last move.
+}
+
+TEST_F(GameLogicTest, TestSeekToOutOfRange)
+{
+    gameLogic.makeMove({0, 0});
+    EXPECT_THROW(gameLogic.seekTo(-1), std::out_of_range);
+    EXPECT_THROW(gameLogic.seekTo(2), std::out_of_range);
+    EXPECT_NO_THROW(gameLogic.seekTo(1));
+}
+
+TEST_F(GameLogicTest, TestMakeMoveAfterSeekDropsRedo)
+{
+    std::vector<GameLogic::Move> moves;
+    for (int i = 0; i < 300; ++i)
+    {
+        moves.push_back({i % 3, i / 3 % 3});
+        gameLogic.makeMove(moves.back());
+    }
+    gameLogic.seekTo(100);
+    moves.resize(100);
+    for (int i = 0; i < 50; ++i)
+    {
+        moves.push_back({2, i % 3});
+        gameLogic.makeMove(moves.back());
+    }
+    EXPECT_EQ(gameLogic.getHistorySize(), 150);
+    EXPECT_FALSE(gameLogic.isCanRedo());
+
+    // Checkpoints after the old position were replaced, seeking uses the new moves.
+    for (int index : {0, 63, 64, 65, 100, 128, 149, 150, 7})
+    {
+        gameLogic.seekTo(index);
+        expectBoardAfter(gameLogic, moves, index);
+    }
+}
+
+TEST_F(GameLogicTest, TestSeekToRandomPositions)
+{
+    std::mt19937 gen(6);
+    for (int size : {1, 3, 4, 8, 13})
+    {
+        for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                           GameLogic::Storage::Lazy})
+        {
+            GameLogic game(size);
+            game.setStorage(storage);
+            std::uniform_int_distribution<> cell(0, size - 1);
+            std::vector<GameLogic::Move> moves;
+            for (int i = 0; i < 1000; ++i)
+            {
+                moves.push_back({cell(gen), cell(gen)});
+                game.makeMove(moves.back());
+            }
+            std::uniform_int_distribution<> position(0, 1000);
+            for (int i = 0; i < 40; ++i)
+            {
+                int index = i % 10 == 0 ? game.getNumMoves() + 1 - (i % 20) : position(gen); // Short steps too.
+                index = std::max(0, std::min(1000, index));
+                game.seekTo(index);
+                ASSERT_EQ(game.getNumMoves(), index);
+                expectBoardAfter(game, moves, index);
+            }
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestSeekAfterInit)
+{
+    gameLogic.setDifficulty(5);
+    gameLogic.init();
+    int values[3][3];
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            values[i][j] = gameLogic.getBoardValue({i, j});
+        }
+    }
+    for (int i = 0; i < 200; ++i)
+    {
+        gameLogic.makeMove({i % 3, (i * 7) % 3});
+    }
+    gameLogic.seekTo(0); // Back to the generated board, not to the won board.
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            EXPECT_EQ(gameLogic.getBoardValue({i, j}), values[i][j]);
+        }
+    }
+    EXPECT_TRUE(gameLogic.isCanHint());
+}
+
+TEST_F(GameLogicTest, TestSeekToWinningMove)
+{
+    gameLogic.setDifficulty(5);
+    gameLogic.init();
+    while (!gameLogic.isWin())
+    {
+        gameLogic.makeMove(gameLogic.hintNextMove());
+    }
+    int winning = gameLogic.getNumMoves();
+    gameLogic.makeMove({0, 0}); // Play past the win, so the winning move is in the middle of the history.
+    gameLogic.seekTo(0);
+    EXPECT_TRUE(gameLogic.isCanHint());
+    gameLogic.seekTo(winning);
+    EXPECT_FALSE(gameLogic.isCanHint());
+    EXPECT_THROW(gameLogic.hintNextMove(), std::runtime_error);
+    EXPECT_TRUE(gameLogic.isCanUndo());
+    EXPECT_TRUE(gameLogic.isCanRedo());
+    gameLogic.undoMoves(1);
+    EXPECT_TRUE(gameLogic.isCanHint());
+    gameLogic.seekTo(winning + 1);
+    gameLogic.undoMoves(1); // Undo back onto the won board.
+    EXPECT_FALSE(gameLogic.isCanHint());
+    EXPECT_TRUE(gameLogic.isWin());
+}
@@ -0,0 +1,233 @@
+#include "gamelogic.hpp"
+#include "boardkernel.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Apply press counts to a board with the generic kernel.
+static std::vector<int> applyPresses(std::vector<int> board, int size, const std::vector<int> &presses)
+{
+    BoardKernel<0> kernel(size);
+    for (int cell = 0; cell < size * size; ++cell)
+    {
+        for (int i = 0; i < presses[cell]; ++i)
+        {
+            kernel.increment(board.data(), cell / size, cell % size);
+        }
+    }
+    return board;
+}
+
+static std::vector<int> boardFromPresses(int size, const std::vector<int> &presses)
+{
+    return applyPresses(std::vector<int>(size * size, 9), size, presses);
+}
+
+template <int N>
+static void expectKernelsAgree()
+{
+    std::mt19937 gen(N);
+    std::uniform_int_distribution<> distrib(0, N - 1);
+    std::vector<int> fixed(N * N, 9), generic(N * N, 9);
+    BoardKernel<N> fixedKernel;
+    BoardKernel<0> genericKernel(N);
+    for (int i = 0; i < 500; ++i)
+    {
+        int row = distrib(gen);
+        int col = distrib(gen);
+        if (i % 3 == 0)
+        {
+            fixedKernel.decrement(fixed.data(), row, col);
+            genericKernel.decrement(generic.data(), row, col);
+        }
+        else
+        {
+            fixedKernel.increment(fixed.data(), row, col);
+            genericKernel.increment(generic.data(), row, col);
+        }
+        ASSERT_EQ(fixed, generic);
+        ASSERT_EQ(fixedKernel.isSolved(fixed.data()), genericKernel.isSolved(generic.data()));
+    }
+    std::fill(fixed.begin(), fixed.end(), 9);
+    EXPECT_TRUE(fixedKernel.isSolved(fixed.data()));
+}
+
+TEST_F(GameLogicTest, TestSizeOutOfRange)
+{
+    EXPECT_THROW(GameLogic(0), std::out_of_range);
+    EXPECT_THROW(GameLogic(MAX_SIZE + 1), std::out_of_range);
+    EXPECT_THROW(gameLogic.setSize(-1), std::out_of_range);
+    EXPECT_EQ(gameLogic.getSize(), DEFAULT_SIZE);
+}
+
+TEST_F(GameLogicTest, TestSetSizeResetsGame)
+{
+    gameLogic.setDifficulty(9);
+    gameLogic.init();
+    gameLogic.makeMove({0, 0});
+    gameLogic.setSize(2);
+    EXPECT_EQ(gameLogic.getSize(), 2);
+    EXPECT_EQ(gameLogic.getNumMoves(), 0);
+    EXPECT_EQ(gameLogic.getDifficulty(), 4);
+    EXPECT_FALSE(gameLogic.isCanUndo());
+    EXPECT_THROW(gameLogic.makeMove({2, 0}), std::out_of_range);
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_F(GameLogicTest, TestMakeMoveLargeBoard)
+{
+    GameLogic game(1024);
+    game.makeMove({1023, 5});
+    EXPECT_EQ(game.getBoardValue({1023, 0}), 1);
+    EXPECT_EQ(game.getBoardValue({1023, 5}), 1);
+    EXPECT_EQ(game.getBoardValue({0, 5}), 1);
+    EXPECT_EQ(game.getBoardValue({0, 0}), 9);
+    EXPECT_THROW(game.makeMove({1024, 0}), std::out_of_range);
+    game.undoMove();
+    EXPECT_TRUE(game.isWin());
+}
+
+TEST_F(GameLogicTest, TestSpecializedKernelsMatchGeneric)
+{
+    expectKernelsAgree<3>();
+    expectKernelsAgree<4>();
+    expectKernelsAgree<5>();
+    expectKernelsAgree<8>();
+}
+
+TEST_F(GameLogicTest, TestSolverBruteForceSmallBoards)
+{
+    for (int size = 1; size <= 2; ++size)
+    {
+        // Minimum number of presses for every reachable board, by trying every press vector.
+        // Presses p solve the board made by pressing every cell (9 - p) times from the won board.
+        int cells = size * size;
+        std::map<std::vector<int>, int> best;
+        std::vector<int> presses(cells, 0), inverse(cells);
+        while (true)
+        {
+            int total = 0;
+            for (int cell = 0; cell < cells; ++cell)
+            {
+                total += presses[cell];
+                inverse[cell] = (9 - presses[cell]) % 9;
+            }
+            std::vector<int> board = boardFromPresses(size, inverse);
+            auto it = best.find(board);
+            if (it == best.end())
+                best.emplace(board, total);
+            else if (total < it->second)
+                it->second = total;
+
+            int cell = 0;
+            while (cell < cells && ++presses[cell] == 9)
+                presses[cell++] = 0;
+            if (cell == cells)
+                break;
+        }
+
+        std::vector<int> solution(cells);
+        for (const auto &entry : best)
+        {
+            EXPECT_EQ(Solver::solve(entry.first.data(), size, solution.data()), entry.second);
+            EXPECT_EQ(applyPresses(entry.first, size, solution), std::vector<int>(cells, 9));
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestSolverKernelSearch)
+{
+    // On 4x4 pressing whole rows and columns 3 or 6 times leaves the board unchanged, the solver must find the cheapest of them.
+    std::mt19937 gen(4);
+    std::uniform_int_distribution<> distrib(0, 8);
+    for (int round = 0; round < 50; ++round)
+    {
+        std::vector<int> presses(16);
+        for (auto &count : presses)
+            count = distrib(gen);
+        std::vector<int> board = boardFromPresses(4, presses);
+
+        int bruteForce = 1000;
+        for (int rows = 0; rows < 81; ++rows)
+        {
+            for (int cols = 0; cols < 81; ++cols)
+            {
+                int r[4] = {rows % 3 * 3, rows / 3 % 3 * 3, rows / 9 % 3 * 3, 0};
+                int c[4] = {cols % 3 * 3, cols / 3 % 3 * 3, cols / 9 % 3 * 3, 0};
+                r[3] = (18 - r[0] - r[1] - r[2]) % 9;
+                c[3] = (18 - c[0] - c[1] - c[2]) % 9;
+                int total = 0;
+                for (int cell = 0; cell < 16; ++cell)
+                {
+                    // Board needs (9 - presses) more presses per cell to win, shifted by the kernel element.
+                    total += ((9 - presses[cell]) + r[cell / 4] + c[cell % 4]) % 9;
+                }
+                bruteForce = std::min(bruteForce, total);
+            }
+        }
+        std::vector<int> solution(16);
+        EXPECT_EQ(Solver::solve(board.data(), 4, solution.data()), bruteForce);
+    }
+}
+
+TEST_F(GameLogicTest, TestSolverSolvesAllSizes)
+{
+    std::mt19937 gen(7);
+    for (int size = 1; size <= 14; ++size)
+    {
+        std::uniform_int_distribution<> distrib(0, size - 1);
+        GameLogic game(size);
+        std::vector<int> counts(size * size, 0);
+        for (int i = 0; i < 3 * size; ++i)
+        {
+            GameLogic::Move move = {distrib(gen), distrib(gen)};
+            game.makeMove(move);
+            ++counts[move.row * size + move.col];
+        }
+        int trivial = 0;
+        std::vector<int> board(size * size);
+        for (int cell = 0; cell < size * size; ++cell)
+        {
+            trivial += (9 - counts[cell] % 9) % 9;
+            board[cell] = game.getBoardValue({cell / size, cell % size});
+        }
+
+        // Solution must win the game and never be worse than undoing every move.
+        std::vector<int> solution(size * size);
+        int distance = Solver::solve(board.data(), size, solution.data());
+        EXPECT_LE(distance, trivial);
+        for (int cell = 0; cell < size * size; ++cell)
+        {
+            for (int i = 0; i < solution[cell]; ++i)
+            {
+                game.makeMove({cell / size, cell % size});
+            }
+        }
+        EXPECT_TRUE(game.isWin()) << "size " << size;
+    }
+}
+
+TEST_F(GameLogicTest, TestHintSpecializedSizes)
+{
+    for (int size : {4, 5, 8, 11})
+    {
+        gameLogic.setSize(size);
+        gameLogic.setDifficulty(size);
+        gameLogic.init();
+        int distance = gameLogic.getOptimalDistance();
+        for (int left = distance; left > 0; --left)
+        {
+            gameLogic.makeMove(gameLogic.hintNextMove());
+            ASSERT_EQ(gameLogic.getOptimalDistance(), left - 1) << "size " << size;
+        }
+        EXPECT_TRUE(gameLogic.isWin());
+    }
+}
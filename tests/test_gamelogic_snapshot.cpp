@@ -0,0 +1,135 @@
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Check that both games show the same board and history state.
+static void expectSameGame(const GameLogic &restored, const GameLogic &saved)
+{
+    ASSERT_EQ(restored.getSize(), saved.getSize());
+    ASSERT_EQ(restored.getStorage(), saved.getStorage());
+    ASSERT_EQ(restored.getDifficulty(), saved.getDifficulty());
+    ASSERT_EQ(restored.getSeed(), saved.getSeed());
+    ASSERT_EQ(restored.getNumMoves(), saved.getNumMoves());
+    ASSERT_EQ(restored.getHistorySize(), saved.getHistorySize());
+    ASSERT_EQ(restored.isCanUndo(), saved.isCanUndo());
+    ASSERT_EQ(restored.isCanRedo(), saved.isCanRedo());
+    ASSERT_EQ(restored.isCanHint(), saved.isCanHint());
+    for (int i = 0; i < saved.getSize(); ++i)
+    {
+        for (int j = 0; j < saved.getSize(); ++j)
+        {
+            ASSERT_EQ(restored.getBoardValue({i, j}), saved.getBoardValue({i, j})) << "cell " << i << ", " << j;
+        }
+    }
+}
+
+TEST_F(GameLogicTest, TestSnapshotRoundTrip)
+{
+    std::string path = ::testing::TempDir() + "target9_snapshot.t9s";
+    gameLogic.setDifficulty(5);
+    gameLogic.init();
+    gameLogic.makeMoves({{0, 1}, {2, 2}, {1, 0}, {1, 1}});
+    gameLogic.undoMoves(2);
+    ASSERT_TRUE(gameLogic.saveSnapshot(path));
+
+    GameLogic restored(7);
+    ASSERT_TRUE(restored.loadSnapshot(path));
+    expectSameGame(restored, gameLogic);
+
+    // History continues where it was saved.
+    restored.redoMove();
+    gameLogic.redoMove();
+    expectSameGame(restored, gameLogic);
+    restored.seekTo(0);
+    gameLogic.seekTo(0);
+    expectSameGame(restored, gameLogic);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestSnapshotPackedLongHistory)
+{
+    std::string path = ::testing::TempDir() + "target9_snapshot_long.t9s";
+    GameLogic game(12);
+    game.setStorage(GameLogic::Storage::Packed);
+    game.setDifficulty(40);
+    game.init();
+    std::mt19937 gen(15);
+    std::uniform_int_distribution<> cell(0, 11);
+    std::vector<GameLogic::Move> moves(100000);
+    for (GameLogic::Move &move : moves)
+    {
+        move = {cell(gen), cell(gen)};
+    }
+    game.makeMoves(moves);
+    game.seekTo(54321);
+    ASSERT_TRUE(game.saveSnapshot(path));
+
+    GameLogic restored;
+    ASSERT_TRUE(restored.loadSnapshot(path));
+    expectSameGame(restored, game);
+    for (int index : {99999, 12345, 100000, 0, 777})
+    {
+        restored.seekTo(index); // Uses the restored checkpoints.
+        game.seekTo(index);
+        expectSameGame(restored, game);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestSnapshotInvalidFile)
+{
+    std::string path = ::testing::TempDir() + "target9_snapshot_bad.t9s";
+    gameLogic.makeMove({1, 1});
+    EXPECT_FALSE(gameLogic.loadSnapshot(path + ".missing"));
+
+    GameLogic other(4);
+    other.makeMove({3, 3});
+    ASSERT_TRUE(other.saveSnapshot(path));
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    std::fseek(file, 0, SEEK_END);
+    std::fputc(0, file); // One byte too many.
+    std::fclose(file);
+    EXPECT_FALSE(gameLogic.loadSnapshot(path));
+
+    // The game is unchanged.
+    EXPECT_EQ(gameLogic.getSize(), 3);
+    EXPECT_EQ(gameLogic.getNumMoves(), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({1, 0}), 1);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestSnapshotDamagedCheckpoint)
+{
+    std::string path = ::testing::TempDir() + "target9_snapshot_checkpoint.t9s";
+    GameLogic other;
+    other.setDifficulty(5);
+    other.init();
+    for (int i = 0; i < 100; ++i)
+    {
+        other.makeMove({i % 3, i * 7 % 3}); // Two checkpoints on a 3x3 board, the second one ends the file.
+    }
+    other.seekTo(70);
+    ASSERT_TRUE(other.saveSnapshot(path));
+    ASSERT_TRUE(gameLogic.loadSnapshot(path));
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    std::fseek(file, -1, SEEK_END);
+    int stored = std::fgetc(file);
+    for (int value : {0, 10, stored % 9 + 1}) // Out of range, then a wrong value in range.
+    {
+        std::fseek(file, -1, SEEK_END);
+        std::fputc(value, file);
+        std::fflush(file);
+        EXPECT_FALSE(gameLogic.loadSnapshot(path)) << "checkpoint value " << value;
+    }
+    std::fclose(file);
+    EXPECT_EQ(gameLogic.getNumMoves(), 70); // The last valid snapshot is still loaded.
+    std::remove(path.c_str());
+}
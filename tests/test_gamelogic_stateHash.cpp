@@ -0,0 +1,116 @@
+#include "boardhash.hpp"
+#include "gamelogic.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Hash of the board recomputed from its values.
+static uint64_t recomputeHash(const GameLogic &game)
+{
+    int size = game.getSize();
+    std::vector<int> values(static_cast<std::size_t>(size) * size);
+    for (int i = 0; i < size * size; ++i)
+    {
+        values[i] = game.getBoardValue({i / size, i % size});
+    }
+    return hashBoard(values.data(), size);
+}
+
+// Random moves, undos and redos, the hash is compared with a full recomputation after each one.
+static void playAndCheck(GameLogic &game, int steps, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<> cell(0, game.getSize() - 1);
+    std::uniform_int_distribution<> action(0, 5);
+    for (int i = 0; i < steps; ++i)
+    {
+        int pick = action(gen);
+        if (pick == 4 && game.isCanUndo())
+        {
+            game.undoMove();
+        }
+        else if (pick == 5 && game.isCanRedo())
+        {
+            game.redoMove();
+        }
+        else
+        {
+            game.makeMove({cell(gen), cell(gen)});
+        }
+        ASSERT_EQ(game.stateHash(), recomputeHash(game)) << "size " << game.getSize() << ", step " << i;
+    }
+}
+
+TEST_F(GameLogicTest, TestStateHashMatchesRecomputation)
+{
+    std::mt19937 gen(23);
+    for (GameLogic::Storage storage : {GameLogic::Storage::Dense, GameLogic::Storage::Packed, GameLogic::Storage::Tiled,
+                                       GameLogic::Storage::Lazy})
+    {
+        for (int size : {2, 3, 4})
+        {
+            GameLogic game(size);
+            game.setStorage(storage);
+            playAndCheck(game, 300000, gen); // 3.6 million steps in all.
+        }
+        GameLogic large(37);
+        large.setStorage(storage);
+        playAndCheck(large, 2000, gen);
+    }
+}
+
+TEST_F(GameLogicTest, TestStateHashAfterJumps)
+{
+    std::mt19937 gen(9);
+    gameLogic.setSize(6);
+    gameLogic.setDifficulty(10);
+    gameLogic.init();
+    uint64_t start = gameLogic.stateHash();
+    EXPECT_EQ(start, recomputeHash(gameLogic));
+
+    std::uniform_int_distribution<> cell(0, 5);
+    std::vector<GameLogic::Move> moves(200);
+    for (GameLogic::Move &move : moves)
+    {
+        move = {cell(gen), cell(gen)};
+    }
+    gameLogic.makeMoves(moves); // Rebuilds the board in one pass.
+    EXPECT_EQ(gameLogic.stateHash(), recomputeHash(gameLogic));
+    gameLogic.seekTo(3);
+    EXPECT_EQ(gameLogic.stateHash(), recomputeHash(gameLogic));
+    gameLogic.setStorage(GameLogic::Storage::Packed);
+    EXPECT_EQ(gameLogic.stateHash(), recomputeHash(gameLogic));
+    gameLogic.seekTo(0);
+    EXPECT_EQ(gameLogic.stateHash(), start);
+}
+
+TEST_F(GameLogicTest, TestStateHashIdentifiesBoards)
+{
+    GameLogic first(3);
+    GameLogic second(3);
+    second.setStorage(GameLogic::Storage::Lazy);
+    EXPECT_EQ(first.stateHash(), second.stateHash());
+
+    // Moves commute, so the same moves in another order give the same board and hash.
+    first.makeMove({0, 1});
+    first.makeMove({2, 2});
+    EXPECT_NE(first.stateHash(), second.stateHash());
+    second.makeMove({2, 2});
+    second.makeMove({0, 1});
+    EXPECT_EQ(first.stateHash(), second.stateHash());
+
+    // Nine presses of a cell leave the board as it was.
+    GameLogic won(3);
+    for (int i = 0; i < 9; ++i)
+    {
+        first.makeMove({1, 1});
+    }
+    EXPECT_EQ(first.stateHash(), second.stateHash());
+    EXPECT_NE(won.stateHash(), first.stateHash());
+    EXPECT_NE(GameLogic(4).stateHash(), won.stateHash()); // The size is part of the hash.
+}
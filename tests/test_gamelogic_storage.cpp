@@ -0,0 +1,233 @@
+#include "gamelogic.hpp"
+#include "lazyboard.hpp"
+#include "packedboard.hpp"
+#include "tiledboard.hpp"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+// Every test runs on each storage other than Dense, which is the reference.
+class GameLogicStorageTest : public ::testing::TestWithParam<GameLogic::Storage>
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Check that both games show the same board.
+static void expectSameBoard(const GameLogic &dense, const GameLogic &other)
+{
+    for (int i = 0; i < dense.getSize(); ++i)
+    {
+        for (int j = 0; j < dense.getSize(); ++j)
+        {
+            ASSERT_EQ(dense.getBoardValue({i, j}), other.getBoardValue({i, j})) << "cell " << i << ", " << j;
+        }
+    }
+}
+
+TEST_P(GameLogicStorageTest, TestMakeMoveAllowed)
+{
+    gameLogic.setStorage(GetParam());
+    gameLogic.makeMove({0, 1});
+    EXPECT_EQ(gameLogic.getBoardValue({0, 0}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({0, 1}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({0, 2}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({1, 0}), 9);
+    EXPECT_EQ(gameLogic.getBoardValue({1, 1}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({1, 2}), 9);
+    EXPECT_EQ(gameLogic.getBoardValue({2, 0}), 9);
+    EXPECT_EQ(gameLogic.getBoardValue({2, 1}), 1);
+    EXPECT_EQ(gameLogic.getBoardValue({2, 2}), 9);
+    EXPECT_FALSE(gameLogic.isWin());
+    gameLogic.undoMove();
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_P(GameLogicStorageTest, TestMatchesDense)
+{
+    std::mt19937 gen(3);
+    // Sizes around the edges of packed words (16 cells), tiles (8 cells) and blocks (64 cells).
+    for (int size : {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33, 63, 64, 65, 100, 129})
+    {
+        GameLogic dense(size);
+        GameLogic other(size);
+        other.setStorage(GetParam());
+        std::uniform_int_distribution<> distrib(0, size - 1);
+        for (int i = 0; i < 1500; ++i)
+        {
+            int action = i % 7;
+            if (action == 5 && dense.isCanUndo())
+            {
+                dense.undoMove();
+                other.undoMove();
+            }
+            else if (action == 6 && dense.isCanRedo())
+            {
+                dense.redoMove();
+                other.redoMove();
+            }
+            else
+            {
+                GameLogic::Move move = {distrib(gen), distrib(gen)};
+                dense.makeMove(move);
+                other.makeMove(move);
+            }
+            ASSERT_EQ(dense.isWin(), other.isWin()) << "size " << size << ", step " << i;
+            if (size > 16 && i % 50 != 0)
+                continue;
+            expectSameBoard(dense, other);
+        }
+        expectSameBoard(dense, other);
+        EXPECT_EQ(dense.getNumMoves(), other.getNumMoves());
+    }
+}
+
+TEST_P(GameLogicStorageTest, TestInitHintAndSnapshot)
+{
+    gameLogic.setSize(11); // Crosses the edge of the first tile.
+    gameLogic.setStorage(GetParam());
+    gameLogic.setDifficulty(12);
+    gameLogic.init();
+
+    std::string path = ::testing::TempDir() + "target9_snapshot_storage.t9s";
+    ASSERT_TRUE(gameLogic.saveSnapshot(path));
+    GameLogic restored;
+    ASSERT_TRUE(restored.loadSnapshot(path));
+    std::remove(path.c_str());
+    EXPECT_EQ(restored.getStorage(), GetParam());
+    expectSameBoard(gameLogic, restored);
+
+    // Following the hints must win the game.
+    int distance = gameLogic.getOptimalDistance();
+    for (int left = distance; left > 0; --left)
+    {
+        EXPECT_FALSE(gameLogic.isWin());
+        gameLogic.makeMove(gameLogic.hintNextMove());
+    }
+    EXPECT_TRUE(gameLogic.isWin());
+
+    // Switching back keeps the win.
+    gameLogic.setStorage(GameLogic::Storage::Dense);
+    EXPECT_TRUE(gameLogic.isWin());
+}
+
+TEST_P(GameLogicStorageTest, TestStorageConversionKeepsBoard)
+{
+    gameLogic.setSize(20);
+    gameLogic.setDifficulty(30);
+    gameLogic.init();
+    std::vector<int> before;
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 20; ++j)
+            before.push_back(gameLogic.getBoardValue({i, j}));
+
+    gameLogic.setStorage(GetParam());
+    EXPECT_EQ(gameLogic.getStorage(), GetParam());
+    gameLogic.makeMove({19, 3});
+    gameLogic.setStorage(GameLogic::Storage::Dense);
+    gameLogic.undoMove();
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 20; ++j)
+            EXPECT_EQ(gameLogic.getBoardValue({i, j}), before[i * 20 + j]);
+}
+
+INSTANTIATE_TEST_SUITE_P(Storages, GameLogicStorageTest,
+                         ::testing::Values(GameLogic::Storage::Packed, GameLogic::Storage::Tiled, GameLogic::Storage::Lazy),
+                         [](const ::testing::TestParamInfo<GameLogic::Storage> &info)
+                         {
+                             switch (info.param)
+                             {
+                             case GameLogic::Storage::Packed:
+                                 return std::string("Packed");
+                             case GameLogic::Storage::Tiled:
+                                 return std::string("Tiled");
+                             case GameLogic::Storage::Lazy:
+                                 return std::string("Lazy");
+                             default:
+                                 return std::string("Dense");
+                             }
+                         });
+
+TEST(StorageLayoutTest, TestPackedBoardMemory)
+{
+    PackedBoard board;
+    board.reset(1024);
+    EXPECT_EQ(board.bytes(), 1024u * 1024u / 2u);
+    EXPECT_TRUE(board.isSolved());
+}
+
+TEST(StorageLayoutTest, TestTiledBoardLayout)
+{
+    TiledBoard board;
+    board.reset(4096);
+    EXPECT_EQ(board.bytes(), 4096u * 4096u); // One byte per cell, no padding at multiples of 64.
+    board.reset(65);
+    EXPECT_EQ(board.bytes(), 128u * 128u); // Padded to whole blocks.
+    EXPECT_TRUE(board.isSolved());
+
+    // A move on the last row and column only touches cells of the board.
+    EXPECT_EQ(board.increment(64, 64), 129);
+    EXPECT_EQ(board.value(64, 0), 1);
+    EXPECT_EQ(board.value(0, 64), 1);
+    EXPECT_EQ(board.value(63, 63), 9);
+    EXPECT_EQ(board.decrement(64, 64), -129);
+    EXPECT_TRUE(board.isSolved());
+}
+
+// Three presses of both cells off the diagonal of a 2x2 board give 6 3 / 3 6: every line sum is 0 but the game
+// is not won, so isWin() of lazy storage must read the board. Three presses of both diagonal cells then win it.
+TEST(StorageLayoutTest, TestLazyWinNeedsEveryCell)
+{
+    GameLogic lazy(2);
+    lazy.setStorage(GameLogic::Storage::Lazy);
+    for (int i = 0; i < 3; ++i)
+    {
+        lazy.makeMove({0, 1});
+        lazy.makeMove({1, 0});
+    }
+    EXPECT_EQ(lazy.getBoardValue({0, 0}), 6);
+    EXPECT_EQ(lazy.getBoardValue({0, 1}), 3);
+    EXPECT_FALSE(lazy.isWin());
+    for (int i = 0; i < 3; ++i)
+    {
+        lazy.makeMove({0, 0});
+        lazy.makeMove({1, 1});
+    }
+    EXPECT_TRUE(lazy.isWin());
+}
+
+TEST(StorageLayoutTest, TestLazyStorageSwitchKeepsUnsolved)
+{
+    GameLogic game(5);
+    game.setStorage(GameLogic::Storage::Lazy);
+    game.makeMove({1, 2});
+    game.makeMove({3, 4});
+    game.setStorage(GameLogic::Storage::Packed); // Unsolved count is rebuilt when leaving lazy storage.
+    game.undoMove();
+    game.undoMove();
+    EXPECT_TRUE(game.isWin());
+}
+
+TEST(StorageLayoutTest, TestLazyBoardLayout)
+{
+    LazyBoard board;
+    board.reset(1000);
+    EXPECT_EQ(board.bytes(), 1000u * 1000u + 2000u); // One byte per cell and per line.
+    EXPECT_TRUE(board.isSolved());
+    board.increment(999, 0);
+    EXPECT_EQ(board.value(999, 999), 1);
+    EXPECT_EQ(board.value(0, 0), 1);
+    EXPECT_EQ(board.value(999, 0), 1);
+    EXPECT_EQ(board.value(500, 500), 9);
+    for (int i = 0; i < 8; ++i)
+    {
+        board.increment(999, 0);
+    }
+    EXPECT_TRUE(board.isSolved()); // Nine presses change nothing.
+    board.decrement(3, 4);
+    EXPECT_EQ(board.value(3, 0), 8);
+    EXPECT_EQ(board.value(3, 4), 8);
+    board.increment(3, 4);
+    EXPECT_TRUE(board.isSolved());
+}
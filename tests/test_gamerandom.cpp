@@ -0,0 +1,96 @@
+#include "gamelogic.hpp"
+#include "gamerandom.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Board values of a game in row-major order.
+static std::vector<int> boardOf(const GameLogic &game)
+{
+    std::vector<int> values;
+    for (int i = 0; i < game.getSize(); ++i)
+    {
+        for (int j = 0; j < game.getSize(); ++j)
+        {
+            values.push_back(game.getBoardValue({i, j}));
+        }
+    }
+    return values;
+}
+
+TEST(GameRandomTest, TestPhiloxKnownAnswer)
+{
+    // Philox4x32-10 with zero key and counter, from the Random123 known-answer tests.
+    GameRandom random(0, 0, GameRandom::Engine::Philox);
+    EXPECT_EQ(random(), 0xE169C58D6627E8D5ULL);
+    EXPECT_EQ(random(), 0x9B00DBD8BC57AC4CULL);
+}
+
+TEST(GameRandomTest, TestSameSeedSameSequence)
+{
+    for (GameRandom::Engine engine : {GameRandom::Engine::Xoshiro, GameRandom::Engine::Philox})
+    {
+        GameRandom first(42, 3, engine);
+        GameRandom second(42, 3, engine);
+        GameRandom otherStream(42, 4, engine);
+        int same = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            uint64_t value = first();
+            ASSERT_EQ(value, second());
+            same += value == otherStream();
+        }
+        EXPECT_EQ(same, 0);
+        first.seed(42, 3);
+        second.seed(42, 3);
+        EXPECT_EQ(first(), second());
+    }
+}
+
+TEST(GameRandomTest, TestBelowInRange)
+{
+    GameRandom random(7);
+    std::vector<int> counts(5, 0);
+    for (int i = 0; i < 5000; ++i)
+    {
+        uint64_t value = random.below(5);
+        ASSERT_LT(value, 5u);
+        ++counts[value];
+    }
+    for (int count : counts)
+    {
+        EXPECT_GT(count, 800);
+    }
+}
+
+TEST(GameRandomTest, TestInitReproducibleFromSeed)
+{
+    GameLogic first(5), second(5);
+    first.setDifficulty(12);
+    second.setDifficulty(12);
+    first.init();
+    second.setSeed(first.getSeed());
+    second.init();
+    EXPECT_EQ(boardOf(first), boardOf(second));
+    EXPECT_EQ(first.getSeed(), second.getSeed());
+
+    second.init(); // No seed set, a new board is drawn.
+    EXPECT_NE(first.getSeed(), second.getSeed());
+}
+
+TEST(GameRandomTest, TestInitStreams)
+{
+    GameLogic first(6), second(6), third(6);
+    for (GameLogic *game : {&first, &second, &third})
+    {
+        game->setDifficulty(20);
+        game->setSeed(2026);
+    }
+    first.setRandomStream(1);
+    second.setRandomStream(1);
+    third.setRandomStream(2);
+    first.init();
+    second.init();
+    third.init();
+    EXPECT_EQ(boardOf(first), boardOf(second));
+    EXPECT_NE(boardOf(first), boardOf(third));
+}
@@ -0,0 +1,387 @@
+#include "gamelogic.hpp"
+#include "gameserver.hpp"
+#include "serverprotocol.hpp"
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    GameServer::Request makeRequest(GameServer::Command command, uint64_t session = 0)
+    {
+        GameServer::Request request;
+        request.command = command;
+        request.session = session;
+        return request;
+    }
+}
+
+TEST(GameServerTest, TestSessionCommands)
+{
+    GameServer server(2);
+    GameServer::Request create = makeRequest(GameServer::Command::New);
+    create.size = 4;
+    create.difficulty = 5;
+    create.seeded = true;
+    create.seed = 42;
+    create.tag = 7;
+    GameServer::Response created = server.execute(create);
+    ASSERT_TRUE(created.ok) << created.error;
+    EXPECT_EQ(created.tag, 7u);
+    EXPECT_EQ(created.size, 4);
+    EXPECT_EQ(created.seed, 42u);
+    EXPECT_EQ(server.getSessionCount(), 1u);
+
+    // The session plays the same board as a game with the same seed.
+    GameLogic game(4);
+    game.setDifficulty(5);
+    game.setSeed(42);
+    game.init();
+    ASSERT_EQ(created.board.size(), 16u);
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(created.board[i], game.getBoardValue({i / 4, i % 4}));
+    }
+
+    uint64_t session = created.session;
+    GameServer::Request move = makeRequest(GameServer::Command::Move, session);
+    move.row = 1;
+    move.col = 2;
+    EXPECT_EQ(server.execute(move).moves, 1);
+    game.makeMove({1, 2});
+    GameServer::Response state = server.execute(makeRequest(GameServer::Command::State, session));
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(state.board[i], game.getBoardValue({i / 4, i % 4}));
+    }
+
+    EXPECT_EQ(server.execute(makeRequest(GameServer::Command::Undo, session)).moves, 0);
+    EXPECT_EQ(server.execute(makeRequest(GameServer::Command::Redo, session)).moves, 1);
+    GameServer::Response hint = server.execute(makeRequest(GameServer::Command::Hint, session));
+    GameLogic::Move expected = game.hintNextMove();
+    EXPECT_EQ(hint.row, expected.row);
+    EXPECT_EQ(hint.col, expected.col);
+
+    EXPECT_TRUE(server.execute(makeRequest(GameServer::Command::Close, session)).ok);
+    EXPECT_EQ(server.getSessionCount(), 0u);
+}
+
+TEST(GameServerTest, TestErrors)
+{
+    GameServer server(1);
+    GameServer::Response unknown = server.execute(makeRequest(GameServer::Command::Move, 99));
+    EXPECT_FALSE(unknown.ok);
+    EXPECT_EQ(unknown.error, "Unknown session 99");
+
+    GameServer::Request create = makeRequest(GameServer::Command::New);
+    create.size = 0;
+    GameServer::Response created = server.execute(create);
+    EXPECT_FALSE(created.ok);
+    EXPECT_EQ(created.session, 0u);
+
+    // A failed command leaves the session usable.
+    uint64_t session = server.execute(makeRequest(GameServer::Command::New)).session;
+    EXPECT_FALSE(server.execute(makeRequest(GameServer::Command::Undo, session)).ok);
+    EXPECT_TRUE(server.execute(makeRequest(GameServer::Command::State, session)).ok);
+}
+
+// Requests over the limits fail without creating a session, closing a session makes room again.
+TEST(GameServerTest, TestLimits)
+{
+    GameServer::Limits limits;
+    limits.maxSessions = 3;
+    limits.maxCells = 100;
+    limits.maxSize = 8;
+    GameServer server(2, 0, limits);
+
+    GameServer::Request create = makeRequest(GameServer::Command::New);
+    create.size = 9;
+    GameServer::Response refused = server.execute(create);
+    EXPECT_FALSE(refused.ok);
+    EXPECT_EQ(refused.session, 0u);
+    EXPECT_EQ(refused.error, "Board size 9 is over the limit of 8");
+
+    // 64 + 36 cells fill the budget, another board of one cell is over it.
+    create.size = 8;
+    uint64_t large = server.execute(create).session;
+    create.size = 6;
+    ASSERT_TRUE(server.execute(create).ok);
+    create.size = 1;
+    refused = server.execute(create);
+    EXPECT_FALSE(refused.ok);
+    EXPECT_EQ(refused.error, "Too many cells in open sessions, the limit is 100");
+    EXPECT_EQ(server.getSessionCount(), 2u);
+    EXPECT_EQ(server.getCellCount(), 100u);
+
+    EXPECT_TRUE(server.execute(makeRequest(GameServer::Command::Close, large)).ok);
+    EXPECT_EQ(server.getCellCount(), 36u);
+    ASSERT_TRUE(server.execute(create).ok);
+    ASSERT_TRUE(server.execute(create).ok);
+    refused = server.execute(create);
+    EXPECT_FALSE(refused.ok);
+    EXPECT_EQ(refused.error, "Too many sessions, the limit is 3");
+
+    // A board that fails to build gives its reservation back.
+    create.size = 0;
+    EXPECT_FALSE(server.execute(create).ok);
+    EXPECT_EQ(server.getSessionCount(), 3u);
+    EXPECT_EQ(server.getCellCount(), 38u);
+}
+
+// A session with a full history refuses moves until some are undone, the redo moves are then dropped.
+TEST(GameServerTest, TestHistoryLimit)
+{
+    GameServer::Limits limits;
+    limits.maxHistory = 3;
+    GameServer server(1, 0, limits);
+    uint64_t session = server.execute(makeRequest(GameServer::Command::New)).session;
+    GameServer::Request move = makeRequest(GameServer::Command::Move, session);
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(server.execute(move).ok);
+    }
+    GameServer::Response refused = server.execute(move);
+    EXPECT_FALSE(refused.ok);
+    EXPECT_EQ(refused.error, "Too many moves in the session, the limit is 3");
+    EXPECT_EQ(server.execute(makeRequest(GameServer::Command::State, session)).moves, 3);
+
+    EXPECT_TRUE(server.execute(makeRequest(GameServer::Command::Undo, session)).ok);
+    EXPECT_EQ(server.execute(move).moves, 3);
+}
+
+// submit() waits while the queue of a worker is full and continues once the worker takes it.
+TEST(GameServerTest, TestBoundedQueue)
+{
+    GameServer::Limits limits;
+    limits.maxQueue = 2;
+    GameServer server(1, 0, limits);
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> replies(0);
+    server.submit(makeRequest(GameServer::Command::New), [&](const GameServer::Response &)
+                  {
+                      started.set_value();
+                      released.wait(); // Keeps the worker busy.
+                      ++replies; });
+    started.get_future().wait();
+
+    GameServer::Reply count = [&replies](const GameServer::Response &)
+    { ++replies; };
+    server.submit(makeRequest(GameServer::Command::State, 1), count);
+    server.submit(makeRequest(GameServer::Command::State, 1), count);
+    std::atomic<bool> submitted(false);
+    std::thread client([&]
+                       {
+                           server.submit(makeRequest(GameServer::Command::State, 1), count);
+                           submitted = true; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(submitted);
+
+    release.set_value();
+    client.join();
+    EXPECT_TRUE(submitted);
+    for (int i = 0; i < 3000 && replies < 4; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(replies, 4);
+}
+
+// Sessions playing the same opening share hints through the cache of the server.
+TEST(GameServerTest, TestSharedHintCache)
+{
+    GameServer server(2);
+    GameServer::Request create = makeRequest(GameServer::Command::New);
+    create.size = 5;
+    create.difficulty = 12;
+    create.seeded = true;
+    create.seed = 2026;
+    uint64_t first = server.execute(create).session;
+    uint64_t second = server.execute(create).session;
+    GameServer::Response hint = server.execute(makeRequest(GameServer::Command::Hint, first));
+    GameServer::Response shared = server.execute(makeRequest(GameServer::Command::Hint, second));
+    ASSERT_TRUE(shared.ok) << shared.error;
+    EXPECT_EQ(shared.row, hint.row);
+    EXPECT_EQ(shared.col, hint.col);
+    HintCache::Stats stats = server.getHintCacheStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+
+    GameServer uncached(1, 0);
+    uint64_t session = uncached.execute(create).session;
+    GameServer::Response solved = uncached.execute(makeRequest(GameServer::Command::Hint, session));
+    EXPECT_EQ(solved.row, hint.row);
+    EXPECT_EQ(solved.col, hint.col);
+    EXPECT_EQ(uncached.getHintCacheStats().misses, 0u);
+}
+
+TEST(GameServerTest, TestSubmitOnWorkers)
+{
+    const int sessions = 32;
+    const int moves = 50;
+    std::mutex lock;
+    std::condition_variable arrived;
+    std::vector<GameServer::Response> responses;
+    GameServer::Reply reply = [&](const GameServer::Response &response)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        responses.push_back(response);
+        arrived.notify_all();
+    };
+    auto waitFor = [&](std::size_t count)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        return arrived.wait_for(guard, std::chrono::seconds(30), [&]
+                                { return responses.size() >= count; });
+    };
+
+    GameServer server(4);
+    for (int i = 0; i < sessions; ++i)
+    {
+        server.submit(makeRequest(GameServer::Command::New), reply);
+    }
+    ASSERT_TRUE(waitFor(sessions));
+    std::vector<uint64_t> ids;
+    for (const GameServer::Response &response : responses)
+    {
+        ids.push_back(response.session);
+    }
+
+    // Requests of one session run in order, so every session ends with all its moves.
+    for (int i = 0; i < moves; ++i)
+    {
+        for (uint64_t id : ids)
+        {
+            GameServer::Request move = makeRequest(GameServer::Command::Move, id);
+            move.row = i % 3;
+            move.col = (i / 3) % 3;
+            server.submit(move, reply);
+        }
+    }
+    for (uint64_t id : ids)
+    {
+        server.submit(makeRequest(GameServer::Command::State, id), reply);
+    }
+    ASSERT_TRUE(waitFor(sessions * (moves + 2)));
+    std::lock_guard<std::mutex> guard(lock);
+    int states = 0;
+    for (const GameServer::Response &response : responses)
+    {
+        EXPECT_TRUE(response.ok) << response.error;
+        if (response.command == GameServer::Command::State)
+        {
+            EXPECT_EQ(response.moves, moves);
+            ++states;
+        }
+    }
+    EXPECT_EQ(states, sessions);
+    EXPECT_EQ(server.getSessionCount(), static_cast<std::size_t>(sessions));
+}
+
+TEST(GameServerTest, TestJsonProtocol)
+{
+    GameServer::Request request;
+    std::string error;
+    ASSERT_TRUE(ServerProtocol::parseRequest(" {\"cmd\": \"move\", \"tag\":7,\"session\":3, \"row\":1,\"col\":2,\"note\":\"a\\\"b\"} ", request, error)) << error;
+    EXPECT_EQ(request.command, GameServer::Command::Move);
+    EXPECT_EQ(request.tag, 7u);
+    EXPECT_EQ(request.session, 3u);
+    EXPECT_EQ(request.row, 1);
+    EXPECT_EQ(request.col, 2);
+
+    GameServer::Request create;
+    create.command = GameServer::Command::New;
+    create.size = 5;
+    create.difficulty = 3;
+    create.seeded = true;
+    create.seed = 123456789012345ULL;
+    std::string line = ServerProtocol::formatRequest(create);
+    ASSERT_EQ(line.back(), '\n');
+    line.pop_back();
+    ASSERT_TRUE(ServerProtocol::parseRequest(line, request, error)) << error;
+    EXPECT_EQ(request.command, GameServer::Command::New);
+    EXPECT_EQ(request.size, 5);
+    EXPECT_EQ(request.difficulty, 3);
+    EXPECT_TRUE(request.seeded);
+    EXPECT_EQ(request.seed, 123456789012345ULL);
+
+    GameServer::Response response;
+    response.command = GameServer::Command::State;
+    response.tag = 9;
+    response.session = 4;
+    response.moves = 2;
+    response.size = 2;
+    response.seed = 5;
+    response.board = {1, 2, 9, 0};
+    line = ServerProtocol::formatResponse(response);
+    EXPECT_EQ(line, "{\"tag\":9,\"cmd\":\"state\",\"ok\":true,\"session\":4,\"moves\":2,\"won\":false,\"size\":2,\"seed\":5,\"board\":\"1290\"}\n");
+    line.pop_back();
+    GameServer::Response parsed;
+    ASSERT_TRUE(ServerProtocol::parseResponse(line, parsed, error)) << error;
+    EXPECT_EQ(parsed.board, response.board);
+    EXPECT_EQ(parsed.moves, 2);
+
+    response.ok = false;
+    response.error = "Bad \"move\"";
+    line = ServerProtocol::formatResponse(response);
+    line.pop_back();
+    ASSERT_TRUE(ServerProtocol::parseResponse(line, parsed, error)) << error;
+    EXPECT_FALSE(parsed.ok);
+    EXPECT_EQ(parsed.error, response.error);
+
+    // Malformed requests are rejected with a reason, keeping the tag if it was read.
+    EXPECT_FALSE(ServerProtocol::parseRequest("{\"cmd\":\"move\"", request, error));
+    EXPECT_FALSE(ServerProtocol::parseRequest("{\"tag\":3,\"cmd\":\"jump\"}", request, error));
+    EXPECT_EQ(request.tag, 3u);
+    EXPECT_FALSE(ServerProtocol::parseRequest("{\"tag\":3}", request, error));
+    EXPECT_FALSE(ServerProtocol::parseRequest("{\"cmd\":\"move\",\"row\":\"1\"}", request, error));
+    EXPECT_FALSE(ServerProtocol::parseRequest("not json", request, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(GameServerTest, TestBinaryProtocol)
+{
+    GameServer::Request request;
+    request.command = GameServer::Command::New;
+    request.tag = 0xDEADBEEF;
+    request.size = 7;
+    request.difficulty = 4;
+    request.seeded = true;
+    request.seed = 0x0123456789ABCDEFULL;
+    unsigned char bytes[ServerProtocol::REQUEST_BYTES];
+    ServerProtocol::encodeRequest(request, bytes);
+    GameServer::Request decoded;
+    std::string error;
+    ASSERT_TRUE(ServerProtocol::decodeRequest(bytes, decoded, error)) << error;
+    EXPECT_EQ(decoded.tag, request.tag);
+    EXPECT_EQ(decoded.size, 7);
+    EXPECT_EQ(decoded.difficulty, 4);
+    EXPECT_TRUE(decoded.seeded);
+    EXPECT_EQ(decoded.seed, request.seed);
+
+    bytes[0] = 42;
+    EXPECT_FALSE(ServerProtocol::decodeRequest(bytes, decoded, error));
+    EXPECT_EQ(decoded.tag, request.tag);
+
+    GameServer server(1);
+    GameServer::Response response = server.execute(request);
+    std::string frame;
+    ServerProtocol::encodeResponse(response, frame);
+    ASSERT_EQ(frame.size(), ServerProtocol::RESPONSE_HEADER_BYTES + 49);
+    const unsigned char *data = reinterpret_cast<const unsigned char *>(frame.data());
+    EXPECT_EQ(ServerProtocol::responseSize(data), frame.size());
+    GameServer::Response parsed;
+    ASSERT_TRUE(ServerProtocol::decodeResponse(data, frame.size(), parsed));
+    EXPECT_EQ(parsed.tag, response.tag);
+    EXPECT_EQ(parsed.session, response.session);
+    EXPECT_EQ(parsed.seed, response.seed);
+    EXPECT_EQ(parsed.board, response.board);
+    EXPECT_FALSE(ServerProtocol::decodeResponse(data, frame.size() - 1, parsed));
+}
@@ -0,0 +1,255 @@
+#include "boardhash.hpp"
+#include "gamelogic.hpp"
+#include "hintcache.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Row-major values of a game.
+static std::vector<int> boardOf(const GameLogic &game)
+{
+    int size = game.getSize();
+    std::vector<int> values(static_cast<std::size_t>(size) * size);
+    for (int i = 0; i < size * size; ++i)
+    {
+        values[i] = game.getBoardValue({i / size, i % size});
+    }
+    return values;
+}
+
+// Cached hint and distance of a game must be those of the same board solved without a cache.
+static void expectSameHint(const GameLogic &cached, const std::vector<int> &values)
+{
+    GameLogic plain(cached.getSize());
+    plain.setBoard(values.data());
+    ASSERT_EQ(cached.getOptimalDistance(), plain.getOptimalDistance());
+    if (plain.getOptimalDistance() > 0)
+    {
+        GameLogic::Move expected = plain.hintNextMove();
+        GameLogic::Move move = cached.hintNextMove();
+        ASSERT_EQ(move.row, expected.row);
+        ASSERT_EQ(move.col, expected.col);
+    }
+}
+
+TEST(HintCacheTest, TestHitsAndMisses)
+{
+    HintCache cache;
+    std::vector<int> board = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint64_t key = hashBoard(board.data(), 3);
+    HintCache::Hint hint;
+    EXPECT_FALSE(cache.find(key, 3, board.data(), hint));
+
+    HintCache::Hint stored;
+    stored.row = 2;
+    stored.col = 1;
+    stored.distance = 11;
+    cache.insert(key, 3, board.data(), stored);
+    ASSERT_TRUE(cache.find(key, 3, board.data(), hint));
+    EXPECT_EQ(hint.row, 2);
+    EXPECT_EQ(hint.col, 1);
+    EXPECT_EQ(hint.distance, 11);
+
+    // Another board under the same key is a miss, so a hash collision never returns a wrong hint.
+    std::vector<int> other = board;
+    other[4] = 9;
+    EXPECT_FALSE(cache.find(key, 3, other.data(), hint));
+
+    HintCache::Stats stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.evictions, 0u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, HintCache::entryBytes(3));
+
+    cache.clear();
+    EXPECT_FALSE(cache.find(key, 3, board.data(), hint));
+    EXPECT_EQ(cache.getStats().entries, 0u);
+    EXPECT_EQ(cache.getStats().misses, 3u);
+    EXPECT_THROW(HintCache(1024, 0), std::invalid_argument);
+}
+
+TEST(HintCacheTest, TestLeastRecentlyUsedEviction)
+{
+    HintCache cache(3 * HintCache::entryBytes(3), 1); // One shard keeps the exact LRU order.
+    std::vector<std::vector<int>> boards;
+    for (int i = 0; i < 4; ++i)
+    {
+        boards.push_back(std::vector<int>(9, i + 1));
+    }
+    HintCache::Hint hint;
+    for (int i = 0; i < 3; ++i)
+    {
+        hint.distance = i;
+        cache.insert(hashBoard(boards[i].data(), 3), 3, boards[i].data(), hint);
+    }
+    ASSERT_TRUE(cache.find(hashBoard(boards[0].data(), 3), 3, boards[0].data(), hint)); // Board 1 is now the oldest.
+    cache.insert(hashBoard(boards[3].data(), 3), 3, boards[3].data(), hint);
+
+    EXPECT_TRUE(cache.find(hashBoard(boards[0].data(), 3), 3, boards[0].data(), hint));
+    EXPECT_EQ(hint.distance, 0);
+    EXPECT_FALSE(cache.find(hashBoard(boards[1].data(), 3), 3, boards[1].data(), hint));
+    EXPECT_TRUE(cache.find(hashBoard(boards[2].data(), 3), 3, boards[2].data(), hint));
+    EXPECT_TRUE(cache.find(hashBoard(boards[3].data(), 3), 3, boards[3].data(), hint));
+    HintCache::Stats stats = cache.getStats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entries, 3u);
+    EXPECT_LE(stats.bytes, cache.getBudget());
+
+    // A smaller budget evicts down to the most recently used entry, an empty one keeps nothing.
+    cache.setBudget(HintCache::entryBytes(3));
+    EXPECT_EQ(cache.getStats().entries, 1u);
+    EXPECT_EQ(cache.getStats().evictions, 3u);
+    EXPECT_TRUE(cache.find(hashBoard(boards[3].data(), 3), 3, boards[3].data(), hint));
+    cache.setBudget(0);
+    cache.insert(hashBoard(boards[1].data(), 3), 3, boards[1].data(), hint);
+    EXPECT_EQ(cache.getStats().entries, 0u);
+    EXPECT_EQ(cache.getStats().bytes, 0u);
+}
+
+TEST(HintCacheTest, TestGameHintsMatchSolver)
+{
+    std::mt19937 gen(25);
+    auto cache = std::make_shared<HintCache>();
+    GameLogic game;
+    game.setHintCache(cache);
+    for (int size : {4, 5, 8, 4})
+    {
+        game.setSize(size);
+        game.setDifficulty(size * size);
+        game.init();
+        std::vector<int> start = boardOf(game);
+        expectSameHint(game, start);
+
+        std::uniform_int_distribution<> line(0, size - 1);
+        for (int i = 0; i < 20; ++i)
+        {
+            game.makeMove({line(gen), line(gen)});
+            expectSameHint(game, boardOf(game));
+        }
+        // Going back visits boards hinted before, they come from the cache.
+        uint64_t hits = cache->getStats().hits;
+        while (game.isCanUndo())
+        {
+            game.undoMove();
+        }
+        expectSameHint(game, start);
+        EXPECT_GT(cache->getStats().hits, hits);
+    }
+
+    // 3x3 boards are solved faster than looked up, they skip the cache.
+    HintCache::Stats stats = cache->getStats();
+    GameLogic small(3);
+    small.setHintCache(cache);
+    small.setDifficulty(9);
+    small.init();
+    expectSameHint(small, boardOf(small));
+    EXPECT_EQ(cache->getStats().hits + cache->getStats().misses, stats.hits + stats.misses);
+
+    // A won board has no hint, also when its distance is cached.
+    std::vector<int> nines(16, 9);
+    GameLogic won(4);
+    won.setHintCache(cache);
+    won.setBoard(nines.data());
+    EXPECT_EQ(won.getOptimalDistance(), 0);
+    GameLogic again(4);
+    again.setHintCache(cache);
+    again.setBoard(nines.data());
+    uint64_t hits = cache->getStats().hits;
+    EXPECT_THROW(again.hintNextMove(), std::runtime_error);
+    EXPECT_EQ(cache->getStats().hits, hits + 1);
+}
+
+// Boards of different sizes and boards after init() never get an entry of an earlier board.
+TEST(HintCacheTest, TestInitAndSizeChanges)
+{
+    auto cache = std::make_shared<HintCache>();
+    GameLogic game(4);
+    game.setHintCache(cache);
+    game.setSeed(7);
+    game.setDifficulty(16);
+    for (int round = 0; round < 20; ++round)
+    {
+        game.setSize(3 + round % 4);
+        game.init();
+        expectSameHint(game, boardOf(game));
+        game.init();
+        expectSameHint(game, boardOf(game));
+    }
+
+    // Replaying a seed gives a board hinted before.
+    game.setSize(5);
+    game.setSeed(99);
+    game.init();
+    expectSameHint(game, boardOf(game));
+    uint64_t hits = cache->getStats().hits;
+    game.setSeed(99);
+    game.init();
+    game.hintNextMove();
+    EXPECT_EQ(cache->getStats().hits, hits + 1);
+}
+
+TEST(HintCacheTest, TestSnapshotHints)
+{
+    auto cache = std::make_shared<HintCache>();
+    GameLogic game(6);
+    game.setHintCache(cache);
+    game.setDifficulty(20);
+    game.init();
+    GameLogic::Move expected = game.hintNextMove();
+    uint64_t hits = cache->getStats().hits;
+    GameLogic::Move move = GameLogic::hintMove(game.snapshotBoard());
+    EXPECT_EQ(move.row, expected.row);
+    EXPECT_EQ(move.col, expected.col);
+    EXPECT_EQ(cache->getStats().hits, hits + 1);
+
+    // A snapshot of a new board is solved on the calling thread and cached for the game.
+    game.makeMove({2, 3});
+    move = GameLogic::hintMove(game.snapshotBoard());
+    hits = cache->getStats().hits;
+    expected = game.hintNextMove();
+    EXPECT_EQ(cache->getStats().hits, hits + 1);
+    EXPECT_EQ(move.row, expected.row);
+    EXPECT_EQ(move.col, expected.col);
+}
+
+// Games on several threads share a cache small enough to evict all the time.
+TEST(HintCacheTest, TestConcurrentGames)
+{
+    auto cache = std::make_shared<HintCache>(40 * HintCache::entryBytes(4), 4);
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, &failures, t]
+                             {
+            std::mt19937 gen(t % 2); // Pairs of threads play the same boards.
+            std::uniform_int_distribution<> line(0, 3);
+            GameLogic game(4);
+            game.setHintCache(cache);
+            GameLogic plain(4);
+            for (int i = 0; i < 2000; ++i)
+            {
+                GameLogic::Move move = {line(gen), line(gen)};
+                game.makeMove(move);
+                plain.makeMove(move);
+                failures[t] += game.getOptimalDistance() != plain.getOptimalDistance();
+            } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    for (int count : failures)
+    {
+        EXPECT_EQ(count, 0);
+    }
+    HintCache::Stats stats = cache->getStats();
+    EXPECT_EQ(stats.hits + stats.misses, 8000u);
+    EXPECT_GT(stats.hits, 0u);
+    EXPECT_GT(stats.evictions, 0u);
+    EXPECT_LE(stats.bytes, cache->getBudget());
+}
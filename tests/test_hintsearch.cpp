@@ -0,0 +1,251 @@
+#include "gamelogic.hpp"
+#include "hintsearch.hpp"
+#include "solver.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Collects the callbacks of a HintSearch and waits for results.
+struct HintResults
+{
+    std::mutex lock;
+    std::condition_variable arrived;
+    std::vector<uint64_t> ids;
+    std::vector<GameLogic::Move> moves;
+    std::vector<int> percents;
+
+    HintSearch::Progress progress()
+    {
+        return [this](uint64_t, int percent)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            percents.push_back(percent);
+        };
+    }
+
+    HintSearch::Done done()
+    {
+        return [this](uint64_t search, GameLogic::Move move)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            ids.push_back(search);
+            moves.push_back(move);
+            arrived.notify_all();
+        };
+    }
+
+    // Wait until the search with the given id reported, false on timeout.
+    bool waitFor(uint64_t search)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        return arrived.wait_for(guard, std::chrono::seconds(60), [this, search]
+                                { return !ids.empty() && ids.back() == search; });
+    }
+};
+
+TEST(HintSearchTest, TestSnapshotHintMatchesHintNextMove)
+{
+    for (int size : {3, 4, 5, 6})
+    {
+        GameLogic game(size);
+        game.setSeed(size);
+        game.setDifficulty(size);
+        game.init();
+        GameLogic::BoardSnapshot snapshot = game.snapshotBoard();
+        GameLogic::Move expected = game.hintNextMove();
+
+        // The snapshot does not follow the game.
+        game.makeMove({0, 0});
+        GameLogic::Move move = GameLogic::hintMove(snapshot);
+        EXPECT_EQ(move.row, expected.row) << "size " << size;
+        EXPECT_EQ(move.col, expected.col) << "size " << size;
+    }
+}
+
+TEST(HintSearchTest, TestSnapshotNotAllowed)
+{
+    GameLogic game;
+    EXPECT_THROW(game.snapshotBoard(), std::runtime_error); // Hinting is not allowed before init().
+}
+
+TEST(HintSearchTest, TestCancelledSolve)
+{
+    GameLogic game(4);
+    game.init();
+    GameLogic::BoardSnapshot snapshot = game.snapshotBoard();
+    std::vector<int> presses(snapshot.values.size());
+    Solver::Monitor monitor;
+    monitor.cancelled = true;
+    EXPECT_EQ(Solver::solve(snapshot.values.data(), 4, presses.data(), &monitor), Solver::CANCELLED);
+    EXPECT_EQ(GameLogic::hintMove(snapshot, &monitor).row, -1);
+}
+
+TEST(HintSearchTest, TestSearchReportsProgressAndMove)
+{
+    GameLogic game(4);
+    game.setSeed(4);
+    game.setDifficulty(6);
+    game.init();
+    GameLogic::Move expected = game.hintNextMove();
+
+    HintResults results;
+    {
+        HintSearch search(results.progress(), results.done());
+        uint64_t id = search.start(game.snapshotBoard());
+        ASSERT_TRUE(results.waitFor(id));
+    }
+    EXPECT_EQ(results.moves.back().row, expected.row);
+    EXPECT_EQ(results.moves.back().col, expected.col);
+
+    // Progress only grows and ends with the finished search.
+    ASSERT_FALSE(results.percents.empty());
+    for (std::size_t i = 1; i < results.percents.size(); ++i)
+    {
+        EXPECT_GT(results.percents[i], results.percents[i - 1]);
+    }
+    EXPECT_EQ(results.percents.back(), 100);
+}
+
+TEST(HintSearchTest, TestNewSearchCancelsRunningOne)
+{
+    GameLogic first(4);
+    first.setSeed(4);
+    first.setDifficulty(6);
+    first.init();
+    GameLogic second(4);
+    second.setSeed(5);
+    second.setDifficulty(6);
+    second.init();
+    GameLogic::Move expected = second.hintNextMove();
+
+    // The first search waits in its first progress report until the second one is started, however fast the solver is.
+    std::mutex latchLock;
+    std::condition_variable latch;
+    bool firstRunning = false;
+    bool secondStarted = false;
+    HintResults results;
+    HintSearch search(
+        [&](uint64_t id, int)
+        {
+            if (id != 1) // Ids start at 1.
+            {
+                return;
+            }
+            std::unique_lock<std::mutex> guard(latchLock);
+            firstRunning = true;
+            latch.notify_all();
+            latch.wait(guard, [&]
+                       { return secondStarted; });
+        },
+        results.done());
+    uint64_t stale = search.start(first.snapshotBoard());
+    {
+        std::unique_lock<std::mutex> guard(latchLock);
+        ASSERT_TRUE(latch.wait_for(guard, std::chrono::seconds(60), [&]
+                                   { return firstRunning; }));
+    }
+    uint64_t id = search.start(second.snapshotBoard());
+    {
+        std::lock_guard<std::mutex> guard(latchLock);
+        secondStarted = true;
+    }
+    latch.notify_all();
+    ASSERT_TRUE(results.waitFor(id));
+
+    // The first search may still report while it is cancelled, the caller drops it with isCurrent().
+    EXPECT_FALSE(search.isCurrent(stale));
+    std::vector<GameLogic::Move> used;
+    {
+        std::lock_guard<std::mutex> guard(results.lock);
+        for (std::size_t i = 0; i < results.ids.size(); ++i)
+        {
+            if (search.isCurrent(results.ids[i]))
+            {
+                used.push_back(results.moves[i]);
+            }
+        }
+    }
+    ASSERT_EQ(used.size(), 1u);
+    EXPECT_EQ(used[0].row, expected.row);
+    EXPECT_EQ(used[0].col, expected.col);
+}
+
+TEST(HintSearchTest, TestCancelAndSolvedBoard)
+{
+    GameLogic game(3);
+    game.setDifficulty(3);
+    game.init();
+
+    HintResults results;
+    HintSearch search(results.progress(), results.done());
+    search.start(game.snapshotBoard());
+    search.cancel();
+
+    // A won board has no hint, which is reported as no move.
+    GameLogic::BoardSnapshot snapshot;
+    snapshot.size = 3;
+    snapshot.values.assign(9, 9);
+    uint64_t id = search.start(snapshot);
+    ASSERT_TRUE(results.waitFor(id));
+    EXPECT_EQ(results.moves.back().row, -1);
+    EXPECT_FALSE(search.isBusy());
+}
+
+// Results are queued to the thread of the game, as MainWindow does, and a move in between cancels the search.
+TEST(HintSearchTest, TestStaleResultIsDropped)
+{
+    GameLogic game(4);
+    game.setDifficulty(6);
+    game.init();
+
+    HintResults results;
+    HintSearch search(results.progress(), results.done());
+    uint64_t id = search.start(game.snapshotBoard());
+    EXPECT_TRUE(search.isCurrent(id));
+    ASSERT_TRUE(results.waitFor(id)); // The result is queued, not yet shown.
+    game.makeMove({0, 0});
+    search.cancel();
+    EXPECT_FALSE(search.isCurrent(id)); // Arrives after the move, so it is dropped.
+
+    // A newer search makes the earlier one stale even if it already reported.
+    uint64_t first = search.start(game.snapshotBoard());
+    ASSERT_TRUE(results.waitFor(first));
+    uint64_t second = search.start(game.snapshotBoard());
+    EXPECT_FALSE(search.isCurrent(first));
+    EXPECT_TRUE(search.isCurrent(second));
+    ASSERT_TRUE(results.waitFor(second));
+    EXPECT_TRUE(search.isCurrent(second));
+    EXPECT_FALSE(search.isCurrent(0));
+}
+
+// A move while a long search runs cancels it, a result it reports while stopping is not current.
+TEST(HintSearchTest, TestMoveCancelsRunningSearch)
+{
+    GameLogic large(301);
+    large.setDifficulty(200);
+    large.init();
+
+    HintResults results;
+    HintSearch search(results.progress(), results.done());
+    uint64_t id = search.start(large.snapshotBoard());
+    for (bool started = false; !started; std::this_thread::sleep_for(std::chrono::milliseconds(1)))
+    {
+        std::lock_guard<std::mutex> guard(results.lock);
+        started = !results.percents.empty(); // The solver is running.
+    }
+    search.cancel();
+    EXPECT_FALSE(search.isCurrent(id));
+    for (int i = 0; i < 6000 && search.isBusy(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_FALSE(search.isBusy());
+    std::lock_guard<std::mutex> guard(results.lock);
+    for (uint64_t reported : results.ids)
+    {
+        EXPECT_FALSE(search.isCurrent(reported));
+    }
+}
@@ -0,0 +1,318 @@
+#include "gamelogic.hpp"
+#include "movelog.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+
+class GameLogicTest : public ::testing::Test
+{
+protected:
+    GameLogic gameLogic;
+};
+
+// Check that both games show the same board and history state.
+static void expectSameGame(const GameLogic &replayed, const GameLogic &played)
+{
+    ASSERT_EQ(replayed.getSize(), played.getSize());
+    ASSERT_EQ(replayed.getNumMoves(), played.getNumMoves());
+    ASSERT_EQ(replayed.getHistorySize(), played.getHistorySize());
+    ASSERT_EQ(replayed.getSeed(), played.getSeed());
+    for (int i = 0; i < played.getSize(); ++i)
+    {
+        for (int j = 0; j < played.getSize(); ++j)
+        {
+            ASSERT_EQ(replayed.getBoardValue({i, j}), played.getBoardValue({i, j})) << "cell " << i << ", " << j;
+        }
+    }
+}
+
+TEST(MoveLogTest, TestBitsPerEvent)
+{
+    EXPECT_EQ(MoveLogFormat::bitsPerEvent(1), 2);
+    EXPECT_EQ(MoveLogFormat::bitsPerEvent(3), 4);
+    EXPECT_EQ(MoveLogFormat::bitsPerEvent(4), 5);
+    EXPECT_EQ(MoveLogFormat::bitsPerEvent(1024), 21);
+}
+
+TEST_F(GameLogicTest, TestMoveLogReplay)
+{
+    std::string path = ::testing::TempDir() + "target9_replay.t9log";
+    gameLogic.setDifficulty(4);
+    gameLogic.init();
+    ASSERT_TRUE(gameLogic.startMoveLog(path));
+    gameLogic.makeMove({0, 1});
+    gameLogic.makeMoves({{2, 2}, {1, 0}, {1, 0}, {0, 0}, {2, 1}});
+    gameLogic.undoMove();
+    gameLogic.undoMoves(2);
+    gameLogic.redoMove();
+    gameLogic.seekTo(1);
+    gameLogic.seekTo(4);
+    gameLogic.makeMove({1, 1});
+    gameLogic.undoMove();
+    gameLogic.stopMoveLog();
+
+    MoveLogReader reader(path);
+    EXPECT_EQ(reader.getSize(), 3);
+    EXPECT_EQ(reader.getSeed(), gameLogic.getSeed());
+    EXPECT_EQ(reader.getEventCount(), 1u + 5 + 1 + 2 + 1 + 3 + 3 + 1 + 1);
+    GameLogic replayed(5);
+    reader.replay(replayed);
+    expectSameGame(replayed, gameLogic);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestMoveLogReplayRandomLargeBoard)
+{
+    std::string path = ::testing::TempDir() + "target9_random.t9log";
+    GameLogic game(20);
+    game.setDifficulty(30);
+    game.init();
+    ASSERT_TRUE(game.startMoveLog(path));
+    std::mt19937 gen(14);
+    std::uniform_int_distribution<> cell(0, 19);
+    std::uniform_int_distribution<> action(0, 5);
+    for (int step = 0; step < 5000; ++step)
+    {
+        int choice = action(gen);
+        if (choice == 0 && game.isCanUndo())
+            game.undoMove();
+        else if (choice == 1 && game.isCanRedo())
+            game.redoMove();
+        else
+            game.makeMove({cell(gen), cell(gen)});
+    }
+    game.stopMoveLog();
+
+    MoveLogReader reader(path);
+    GameLogic replayed;
+    reader.replay(replayed);
+    expectSameGame(replayed, game);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestMoveLogVerifySolution)
+{
+    std::string path = ::testing::TempDir() + "target9_solution.t9log";
+    gameLogic.setDifficulty(6);
+    gameLogic.init();
+    ASSERT_TRUE(gameLogic.startMoveLog(path));
+    gameLogic.makeMove({0, 0}); // A wrong move, undone below.
+    gameLogic.undoMove();
+    while (gameLogic.getOptimalDistance() > 0)
+    {
+        gameLogic.makeMove(gameLogic.hintNextMove());
+    }
+    gameLogic.stopMoveLog();
+
+    int moves = 0;
+    EXPECT_TRUE(MoveLogReader(path).verifySolution(&moves));
+    EXPECT_EQ(moves, 6);
+
+    ASSERT_TRUE(gameLogic.startMoveLog(path)); // Won board, one move away from it is not a solution.
+    gameLogic.makeMove({2, 0});
+    gameLogic.stopMoveLog();
+    EXPECT_FALSE(MoveLogReader(path).verifySolution(&moves));
+    EXPECT_EQ(moves, 1);
+    std::remove(path.c_str());
+}
+
+TEST_F(GameLogicTest, TestMoveLogReadableWhileRecording)
+{
+    std::string path = ::testing::TempDir() + "target9_open.t9log";
+    ASSERT_TRUE(gameLogic.startMoveLog(path));
+    gameLogic.makeMove({1, 2});
+    gameLogic.makeMove({0, 2});
+    gameLogic.makeMove({2, 2});
+    {
+        MoveLogWriter writer;
+        int board[9] = {9, 9, 9, 9, 9, 9, 9, 9, 9};
+        ASSERT_TRUE(writer.open(path + "2", 3, 7, board));
+        writer.recordMove(1, 1);
+        writer.flush();
+        EXPECT_EQ(MoveLogReader(path + "2").getEventCount(), 1u);
+        writer.recordMove(2, 1);
+        writer.recordUndo();
+        writer.flush();
+        MoveLogReader reader(path + "2");
+        EXPECT_EQ(reader.getEventCount(), 3u);
+        GameLogic replayed;
+        reader.replay(replayed);
+        EXPECT_EQ(replayed.getNumMoves(), 1);
+        EXPECT_EQ(replayed.getHistorySize(), 2);
+        EXPECT_EQ(replayed.getBoardValue({1, 0}), 1);
+    }
+    gameLogic.init(); // Stops the log.
+    EXPECT_EQ(MoveLogReader(path).getEventCount(), 3u);
+    std::remove(path.c_str());
+    std::remove((path + "2").c_str());
+}
+
+// A game restored from a snapshot in a new run keeps recording to its log, which still replays the whole game.
+TEST_F(GameLogicTest, TestMoveLogResumeAfterSnapshot)
+{
+    std::string path = ::testing::TempDir() + "target9_resume.t9log";
+    std::string snapshot = ::testing::TempDir() + "target9_resume.t9s";
+    GameLogic game(20); // 9 bits per event, so the log ends inside a byte.
+    game.setDifficulty(25);
+    game.init();
+    ASSERT_TRUE(game.startMoveLog(path));
+    game.makeMoves({{1, 2}, {19, 0}, {7, 7}});
+    game.undoMove();
+    ASSERT_TRUE(game.saveSnapshot(snapshot));
+    game.stopMoveLog();
+
+    GameLogic resumed;
+    ASSERT_TRUE(resumed.loadSnapshot(snapshot));
+    ASSERT_TRUE(resumed.resumeMoveLog(path));
+    EXPECT_TRUE(resumed.isCanUndo()); // Unlike startMoveLog(), the history is kept.
+    for (GameLogic *played : {&game, &resumed})
+    {
+        played->redoMove();
+        played->makeMove({3, 4});
+        played->undoMoves(2);
+    }
+    resumed.stopMoveLog();
+
+    MoveLogReader reader(path);
+    EXPECT_EQ(reader.getEventCount(), 4u + 1 + 1 + 2);
+    GameLogic replayed;
+    reader.replay(replayed);
+    expectSameGame(replayed, game);
+
+    // A log of another game or of another position is not continued.
+    GameLogic other(20);
+    other.setDifficulty(25);
+    other.init();
+    EXPECT_FALSE(other.resumeMoveLog(path));
+    game.makeMove({0, 0});
+    EXPECT_FALSE(game.resumeMoveLog(path));
+    EXPECT_FALSE(game.resumeMoveLog(::testing::TempDir() + "target9_missing.t9log"));
+    EXPECT_EQ(MoveLogReader(path).getEventCount(), 8u);
+    std::remove(path.c_str());
+    std::remove(snapshot.c_str());
+}
+
+TEST(MoveLogTest, TestInvalidFile)
+{
+    EXPECT_THROW(MoveLogReader(::testing::TempDir() + "target9_missing.t9log"), std::runtime_error);
+    std::string path = ::testing::TempDir() + "target9_invalid.t9log";
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    std::fputs("not a move log, just some text of forty bytes", file);
+    std::fclose(file);
+    EXPECT_THROW(MoveLogReader reader(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+// A long seek is one event in the log, replayed and verified as a jump of the cursor.
+TEST_F(GameLogicTest, TestMoveLogSeekEvent)
+{
+    std::string path = ::testing::TempDir() + "target9_seek.t9log";
+    std::vector<GameLogic::Move> moves;
+    for (int i = 0; i < 3000; ++i)
+    {
+        moves.push_back({i % 3, i * 7 % 3});
+    }
+    ASSERT_TRUE(gameLogic.startMoveLog(path));
+    gameLogic.makeMoves(moves);
+    gameLogic.seekTo(17);
+    gameLogic.seekTo(2999);
+    gameLogic.undoMoves(2000);
+    gameLogic.undoMoves(3); // A short jump stays as undos.
+    gameLogic.makeMove({1, 1});
+    gameLogic.stopMoveLog();
+
+    MoveLogReader reader(path);
+    uint64_t seek = 1 + MoveLogFormat::seekSlots(3);
+    EXPECT_EQ(reader.getEventCount(), 3000 + 3 * seek + 3 + 1); // Not 2983 undos for the first seek.
+    GameLogic replayed;
+    reader.replay(replayed);
+    expectSameGame(replayed, gameLogic);
+    int solution = -1;
+    reader.verifySolution(&solution);
+    EXPECT_EQ(solution, 997);
+    std::remove(path.c_str());
+}
+
+// A seek past the recorded moves is rejected by the reader.
+TEST(MoveLogTest, TestSeekPastHistory)
+{
+    std::string path = ::testing::TempDir() + "target9_bad_seek.t9log";
+    int board[9] = {9, 9, 9, 9, 9, 9, 9, 9, 9};
+    {
+        MoveLogWriter writer;
+        ASSERT_TRUE(writer.open(path, 3, 0, board));
+        writer.recordMove(0, 0);
+        writer.recordSeek(2);
+    }
+    MoveLogReader reader(path);
+    GameLogic game;
+    EXPECT_THROW(reader.replay(game), std::runtime_error);
+    EXPECT_THROW(reader.verifySolution(), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+// Logs written before seek events existed are still read, and appending to them marks them with the new version.
+TEST(MoveLogTest, TestVersionOne)
+{
+    std::string path = ::testing::TempDir() + "target9_version1.t9log";
+    int board[9] = {9, 9, 8, 9, 9, 8, 8, 8, 8}; // Won by a press on the last cell.
+    {
+        MoveLogWriter writer;
+        ASSERT_TRUE(writer.open(path, 3, 0, board));
+        writer.recordMove(2, 2);
+        writer.recordUndo();
+    }
+    uint32_t version = 1;
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    std::fseek(file, 4, SEEK_SET);
+    std::fwrite(&version, sizeof(version), 1, file);
+    std::fclose(file);
+    EXPECT_EQ(MoveLogReader(path).getEventCount(), 2u);
+    {
+        MoveLogWriter writer;
+        ASSERT_TRUE(writer.append(path));
+        writer.recordSeek(1);
+    }
+    file = std::fopen(path.c_str(), "rb");
+    std::fseek(file, 4, SEEK_SET);
+    ASSERT_EQ(std::fread(&version, sizeof(version), 1, file), 1u);
+    std::fclose(file);
+    EXPECT_EQ(version, MoveLogFormat::VERSION);
+    EXPECT_TRUE(MoveLogReader(path).verifySolution());
+    std::remove(path.c_str());
+}
+
+// A new log can start with the history of the game, e.g. when the log of a restored game is lost.
+TEST_F(GameLogicTest, TestMoveLogStartKeepsHistory)
+{
+    std::string path = ::testing::TempDir() + "target9_keep.t9log";
+    GameLogic game(5);
+    game.setDifficulty(8);
+    game.init();
+    std::vector<GameLogic::Move> moves;
+    for (int i = 0; i < 300; ++i)
+    {
+        moves.push_back({i % 5, i * 3 % 5});
+    }
+    game.makeMoves(moves);
+    game.seekTo(120);
+    ASSERT_TRUE(game.startMoveLog(path, true));
+    EXPECT_EQ(game.getNumMoves(), 120);
+    EXPECT_EQ(game.getHistorySize(), 300);
+    EXPECT_TRUE(game.isCanUndo());
+    EXPECT_TRUE(game.isCanRedo());
+    game.redoMove();
+    game.undoMoves(50);
+    game.stopMoveLog();
+
+    MoveLogReader reader(path);
+    EXPECT_EQ(reader.getEventCount(), 300u + 1 + MoveLogFormat::seekSlots(5) + 1 + 1 + MoveLogFormat::seekSlots(5));
+    GameLogic replayed;
+    reader.replay(replayed);
+    expectSameGame(replayed, game);
+    replayed.seekTo(0);
+    game.seekTo(0);
+    expectSameGame(replayed, game);
+    std::remove(path.c_str());
+}
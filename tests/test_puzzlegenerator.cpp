@@ -0,0 +1,130 @@
+#include "boardsymmetry.hpp"
+#include "puzzlegenerator.hpp"
+#include "solver.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+// Generate puzzles and keep them as strings of cell values.
+static std::vector<std::pair<std::string, int>> generate(const PuzzleGenerator::Options &options)
+{
+    PuzzleGenerator generator(options);
+    std::vector<std::pair<std::string, int>> puzzles;
+    const int cells = options.size * options.size;
+    uint64_t count = generator.run([&](const unsigned char *values, int distance)
+                                   { puzzles.emplace_back(std::string(values, values + cells), distance); });
+    EXPECT_EQ(count, puzzles.size());
+    return puzzles;
+}
+
+TEST(PuzzleGeneratorTest, TestUniqueAndLabeled)
+{
+    PuzzleGenerator::Options options;
+    options.size = 3;
+    options.count = 5000;
+    options.threads = 4;
+    options.seed = 8;
+    auto puzzles = generate(options);
+    ASSERT_EQ(puzzles.size(), 5000u);
+
+    std::set<std::string> boards;
+    for (const auto &puzzle : puzzles)
+    {
+        EXPECT_TRUE(boards.insert(puzzle.first).second) << "duplicate puzzle";
+        int board[9];
+        int presses[9];
+        for (int i = 0; i < 9; ++i)
+        {
+            ASSERT_GE(puzzle.first[i], 1);
+            ASSERT_LE(puzzle.first[i], 9);
+            board[i] = puzzle.first[i];
+        }
+        ASSERT_EQ(puzzle.second, Solver::solve(board, 3, presses));
+    }
+}
+
+TEST(PuzzleGeneratorTest, TestExactDistance)
+{
+    for (int size : {3, 4, 5, 6})
+    {
+        PuzzleGenerator::Options options;
+        options.size = size;
+        options.count = 300;
+        options.threads = 2;
+        options.distance = 7;
+        for (const auto &puzzle : generate(options))
+        {
+            ASSERT_EQ(puzzle.second, 7) << "size " << size;
+        }
+    }
+}
+
+TEST(PuzzleGeneratorTest, TestSameSeedSamePuzzles)
+{
+    PuzzleGenerator::Options options;
+    options.size = 4;
+    options.count = 200;
+    options.seed = 42;
+    EXPECT_EQ(generate(options), generate(options));
+    options.seed = 43;
+    auto other = generate(options);
+    options.seed = 42;
+    EXPECT_NE(generate(options), other);
+}
+
+TEST(PuzzleGeneratorTest, TestStopsWhenBoardsRunOut)
+{
+    PuzzleGenerator::Options options;
+    options.size = 2;
+    options.presses = 1; // One press gives only 4 boards.
+    options.count = 20;
+    options.maxAttempts = 10000;
+    PuzzleGenerator generator(options);
+    uint64_t count = generator.run([](const unsigned char *, int) {});
+    EXPECT_EQ(count, 4u);
+    EXPECT_EQ(generator.getAttempts(), 10000u);
+    EXPECT_GT(generator.getDuplicates(), 0u);
+}
+
+TEST(PuzzleGeneratorTest, TestSymmetricDedupe)
+{
+    PuzzleGenerator::Options options;
+    options.size = 2;
+    options.presses = 1; // The 4 boards of one press are one board up to row and column order.
+    options.count = 20;
+    options.maxAttempts = 1000;
+    options.symmetric = true;
+    PuzzleGenerator generator(options);
+    EXPECT_EQ(generator.run([](const unsigned char *, int) {}), 1u);
+
+    options.size = 3;
+    options.presses = -1;
+    options.count = 2000;
+    std::set<std::string> seen;
+    for (const auto &puzzle : generate(options))
+    {
+        int board[9];
+        std::copy(puzzle.first.begin(), puzzle.first.end(), board);
+        std::vector<int> canonical = BoardSymmetry::canonicalize(board, 3).values;
+        EXPECT_TRUE(seen.insert(std::string(canonical.begin(), canonical.end())).second) << "equivalent puzzles";
+    }
+}
+
+TEST(PuzzleGeneratorTest, TestInvalidOptions)
+{
+    PuzzleGenerator::Options options;
+    options.size = 0;
+    EXPECT_THROW(PuzzleGenerator generator(options), std::invalid_argument);
+    options.size = 3;
+    options.threads = 0;
+    EXPECT_THROW(PuzzleGenerator generator(options), std::invalid_argument);
+    options.threads = 1;
+    options.distance = 73;
+    EXPECT_THROW(PuzzleGenerator generator(options), std::invalid_argument);
+    options.distance = -1;
+    options.size = BoardSymmetry::MAX_CANONICAL_SIZE + 1;
+    options.symmetric = true;
+    EXPECT_THROW(PuzzleGenerator generator(options), std::invalid_argument);
+}
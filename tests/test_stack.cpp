@@ -0,0 +1,128 @@
+#include "stack.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+struct Pair
+{
+    int first;
+    int second;
+};
+
+TEST(StackTest, TestPushPopOrder)
+{
+    Stack<int> stack;
+    EXPECT_TRUE(stack.isEmpty());
+    const int count = 3 * static_cast<int>(Stack<int>::CHUNK_SIZE) + 5; // Cross several chunk borders.
+    for (int i = 0; i < count; ++i)
+    {
+        stack.push(i);
+        ASSERT_EQ(stack.top(), i);
+    }
+    EXPECT_EQ(stack.size(), static_cast<std::size_t>(count));
+    for (int i = count - 1; i >= 0; --i)
+    {
+        ASSERT_EQ(stack.pop(), i);
+    }
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_THROW(stack.pop(), std::underflow_error);
+    EXPECT_THROW(stack.top(), std::underflow_error);
+}
+
+TEST(StackTest, TestClear)
+{
+    Stack<int> stack;
+    for (int i = 0; i < 10000; ++i)
+    {
+        stack.push(i);
+    }
+    std::size_t capacity = stack.capacity();
+    stack.clear();
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_EQ(stack.capacity(), capacity); // Chunks are kept for reuse.
+    stack.push(7);
+    EXPECT_EQ(stack.top(), 7);
+    EXPECT_EQ(stack.capacity(), capacity);
+
+    // Pops still release what a clear kept.
+    stack.pop();
+    EXPECT_LE(stack.capacity(), Stack<int>::CHUNK_SIZE);
+}
+
+TEST(StackTest, TestReserveIsKept)
+{
+    Stack<int> stack;
+    stack.reserve(10000);
+    std::size_t capacity = stack.capacity();
+    EXPECT_GE(capacity, 10000u);
+    for (int i = 0; i < 20000; ++i)
+    {
+        stack.push(i);
+    }
+    stack.truncate(0); // Releases down to the reserve, clear() would keep everything.
+    EXPECT_EQ(stack.capacity(), capacity);
+}
+
+TEST(StackTest, TestMemoryIsReleasedOnPop)
+{
+    Stack<int> stack;
+    const std::size_t chunk = Stack<int>::CHUNK_SIZE;
+    for (std::size_t i = 0; i < 10 * chunk; ++i)
+    {
+        stack.push(static_cast<int>(i));
+    }
+    while (stack.size() > chunk)
+    {
+        stack.pop();
+    }
+    EXPECT_LE(stack.capacity(), 2 * chunk); // Chunk in use and one spare.
+
+    // Push and pop across a chunk border keep the spare chunk instead of reallocating.
+    for (int i = 0; i < 100; ++i)
+    {
+        stack.push(i);
+        stack.pop();
+        ASSERT_EQ(stack.capacity(), 2 * chunk);
+    }
+}
+
+TEST(StackTest, TestMoveOnlyValues)
+{
+    Stack<std::unique_ptr<std::string>> stack;
+    for (int i = 0; i < 1000; ++i)
+    {
+        stack.push(std::make_unique<std::string>(std::to_string(i)));
+    }
+    for (int i = 999; i >= 500; --i)
+    {
+        ASSERT_EQ(*stack.pop(), std::to_string(i));
+    }
+    stack.clear(); // Remaining strings are destroyed, checked by sanitizers.
+    EXPECT_TRUE(stack.isEmpty());
+}
+
+TEST(StackTest, TestEmplaceAndCopy)
+{
+    Stack<Pair> stack;
+    for (int i = 0; i < 600; ++i)
+    {
+        Pair &pair = stack.emplace(i, -i);
+        ASSERT_EQ(pair.second, -i);
+    }
+    Stack<Pair> copy(stack);
+    Stack<Pair> moved(std::move(stack));
+    EXPECT_TRUE(stack.isEmpty());
+    for (int i = 599; i >= 0; --i)
+    {
+        ASSERT_EQ(copy.pop().first, i);
+        ASSERT_EQ(moved.pop().first, i);
+    }
+
+    Stack<std::string> strings;
+    strings.push("a");
+    Stack<std::string> other;
+    other = strings;
+    strings.push("b");
+    EXPECT_EQ(other.size(), 1u);
+    EXPECT_EQ(other.top(), "a");
+}
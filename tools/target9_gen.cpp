@@ -0,0 +1,192 @@
+/**
+ * @file target9_gen.cpp
+ * @brief Command line tool that generates packs of unique puzzles with their optimal number of moves.
+ *
+ * Usage: target9-gen [--size N] [--count C] [--distance D | --presses P] [--threads T] [--seed S]
+ *                    [--format binary|csv] [--output PATH] [--symmetric]
+ *
+ * With --symmetric, boards that differ only by the order of rows and columns or by transposition count
+ * as duplicates, for sizes up to 8.
+ *
+ * Binary output: 16-byte header (magic "T9PZ", version, board size, bytes per record) followed by one
+ * record per puzzle: 16-bit little-endian distance and the cells packed two per byte, first cell in the
+ * low nibble. CSV output: one line per puzzle with the distance and the cell values in row-major order.
+ * Throughput is reported on stderr.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+#include "puzzlegenerator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t MAGIC = 0x5A503954; // "T9PZ"
+    constexpr uint32_t VERSION = 1;
+
+    void printUsage()
+    {
+        std::cerr << "Usage: target9-gen [--size N] [--count C] [--distance D | --presses P] [--threads T] [--seed S]"
+                     " [--format binary|csv] [--output PATH] [--symmetric]"
+                  << std::endl;
+    }
+
+    void writeWord(std::FILE *out, uint32_t value)
+    {
+        unsigned char bytes[4] = {static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                                  static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 24)};
+        std::fwrite(bytes, 1, sizeof(bytes), out);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    PuzzleGenerator::Options options;
+    options.threads = static_cast<int>(std::thread::hardware_concurrency());
+    options.seed = std::random_device()();
+    std::string format = "binary";
+    std::string path = "-";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string name = argv[i];
+        if (name == "--help" || name == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        if (name == "--symmetric")
+        {
+            options.symmetric = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (name == "--size")
+            options.size = std::atoi(value.c_str());
+        else if (name == "--count")
+            options.count = std::strtoull(value.c_str(), nullptr, 10);
+        else if (name == "--distance")
+            options.distance = std::atoi(value.c_str());
+        else if (name == "--presses")
+            options.presses = std::atoi(value.c_str());
+        else if (name == "--threads")
+            options.threads = std::atoi(value.c_str());
+        else if (name == "--seed")
+            options.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (name == "--format")
+            format = value;
+        else if (name == "--output")
+            path = value;
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    if (options.threads < 1)
+    {
+        options.threads = 1;
+    }
+    if (format != "binary" && format != "csv")
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::FILE *out = path == "-" ? stdout : std::fopen(path.c_str(), format == "csv" ? "w" : "wb");
+    if (!out)
+    {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    std::vector<char> buffer(1 << 20);
+    std::setvbuf(out, buffer.data(), _IOFBF, buffer.size());
+
+    try
+    {
+        PuzzleGenerator generator(options);
+        const int cells = options.size * options.size;
+        const uint32_t packedBytes = static_cast<uint32_t>((cells + 1) / 2);
+        std::vector<unsigned char> record(2 + packedBytes);
+        std::string line;
+
+        PuzzleGenerator::Sink sink;
+        if (format == "binary")
+        {
+            writeWord(out, MAGIC);
+            writeWord(out, VERSION);
+            writeWord(out, static_cast<uint32_t>(options.size));
+            writeWord(out, static_cast<uint32_t>(record.size()));
+            sink = [&](const unsigned char *values, int distance)
+            {
+                std::memset(record.data(), 0, record.size());
+                record[0] = static_cast<unsigned char>(distance);
+                record[1] = static_cast<unsigned char>(distance >> 8);
+                for (int i = 0; i < cells; ++i)
+                {
+                    record[2 + i / 2] |= static_cast<unsigned char>(values[i] << (i % 2 * 4));
+                }
+                std::fwrite(record.data(), 1, record.size(), out);
+            };
+        }
+        else
+        {
+            std::fputs("distance,cells\n", out);
+            sink = [&](const unsigned char *values, int distance)
+            {
+                line = std::to_string(distance);
+                line += ',';
+                for (int i = 0; i < cells; ++i)
+                {
+                    line += static_cast<char>('0' + values[i]);
+                }
+                line += '\n';
+                std::fwrite(line.data(), 1, line.size(), out);
+            };
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t written = generator.run(sink);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::fflush(out);
+
+        double perSecond = written / elapsed.count();
+        std::cerr << "Generated " << written << " puzzles of size " << options.size << " in " << elapsed.count() << " s"
+                  << " (" << generator.getAttempts() << " boards tried, " << generator.getDuplicates() << " duplicates)" << std::endl;
+        std::cerr << "Seed " << options.seed << std::endl;
+        std::cerr << perSecond << " puzzles/s, " << perSecond / options.threads << " puzzles/s per thread on " << options.threads << " threads" << std::endl;
+        if (!generator.isExact())
+        {
+            std::cerr << "Warning: distances are upper bounds for boards of size " << options.size << std::endl;
+        }
+        if (written < options.count)
+        {
+            std::cerr << "Warning: only " << written << " of " << options.count << " puzzles found" << std::endl;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (out != stdout)
+    {
+        std::fclose(out);
+    }
+    return 0;
+}
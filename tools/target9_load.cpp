@@ -0,0 +1,350 @@
+/**
+ * @file target9_load.cpp
+ * @brief Load generator for target9-server.
+ *
+ * Usage: target9-load --socket PATH [--connections C] [--sessions S] [--ops N] [--size N] [--seed S] [--binary]
+ *
+ * Every connection runs on its own thread, opens S sessions and then sends N requests one at a time,
+ * each on a random session: 80% moves, 10% undos, 5% state and 5% hint requests. The latency of every
+ * request is measured from sending it to receiving its response. Prints the number of requests, p50
+ * and p99 latency per command, total throughput and the number of failed requests.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "gameserver.hpp"
+#include "serverprotocol.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr int COMMAND_COUNT = 8; // Indexed by the command values, 0 is unused.
+
+    struct Options
+    {
+        std::string path;
+        int connections = 4;
+        int sessions = 64;
+        long long ops = 100000;
+        int size = DEFAULT_SIZE;
+        uint64_t seed = 1;
+        bool binary = false;
+    };
+
+    // Latencies in nanoseconds and failures of one connection.
+    struct Results
+    {
+        std::vector<long long> latencies[COMMAND_COUNT];
+        long long errors = 0;
+        std::string failure; // Set if the connection broke.
+    };
+
+    void printUsage()
+    {
+        std::cerr << "Usage: target9-load --socket PATH [--connections C] [--sessions S] [--ops N] [--size N] [--seed S] [--binary]"
+                  << std::endl;
+    }
+
+#ifndef _WIN32
+    // Client side of a connection, sends one request and waits for its response.
+    class Client
+    {
+    public:
+        Client(const std::string &path, bool binary) : binary(binary)
+        {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+            socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (socket < 0 || connect(socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+            {
+                throw std::runtime_error("Cannot connect to " + path + ": " + std::strerror(errno));
+            }
+        }
+
+        ~Client()
+        {
+            if (socket >= 0)
+            {
+                close(socket);
+            }
+        }
+
+        GameServer::Response call(const GameServer::Request &request)
+        {
+            std::string bytes;
+            if (binary)
+            {
+                bytes.resize(ServerProtocol::REQUEST_BYTES);
+                ServerProtocol::encodeRequest(request, reinterpret_cast<unsigned char *>(&bytes[0]));
+            }
+            else
+            {
+                bytes = ServerProtocol::formatRequest(request);
+            }
+            for (std::size_t sent = 0; sent < bytes.size();)
+            {
+                ssize_t written = write(socket, bytes.data() + sent, bytes.size() - sent);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    throw std::runtime_error("Connection lost while sending");
+                sent += static_cast<std::size_t>(written);
+            }
+
+            GameServer::Response response;
+            std::string error;
+            if (binary)
+            {
+                fill(4);
+                std::size_t size = ServerProtocol::responseSize(reinterpret_cast<const unsigned char *>(pending.data()));
+                fill(size);
+                if (!ServerProtocol::decodeResponse(reinterpret_cast<const unsigned char *>(pending.data()), size, response))
+                    throw std::runtime_error("Malformed binary response");
+                pending.erase(0, size);
+            }
+            else
+            {
+                std::size_t end;
+                while ((end = pending.find('\n')) == std::string::npos)
+                {
+                    fill(pending.size() + 1);
+                }
+                if (!ServerProtocol::parseResponse(pending.substr(0, end), response, error))
+                    throw std::runtime_error("Malformed response: " + error);
+                pending.erase(0, end + 1);
+            }
+            if (response.tag != request.tag)
+            {
+                throw std::runtime_error("Response to tag " + std::to_string(response.tag) + " while waiting for " + std::to_string(request.tag));
+            }
+            return response;
+        }
+
+    private:
+        // Read until at least size bytes are pending.
+        void fill(std::size_t size)
+        {
+            char chunk[1 << 16];
+            while (pending.size() < size)
+            {
+                ssize_t received = read(socket, chunk, sizeof(chunk));
+                if (received < 0 && errno == EINTR)
+                    continue;
+                if (received <= 0)
+                    throw std::runtime_error("Connection closed by the server");
+                pending.append(chunk, static_cast<std::size_t>(received));
+            }
+        }
+
+        int socket = -1;
+        bool binary;
+        std::string pending;
+    };
+
+    void runConnection(const Options &options, int index, long long ops, Results &results)
+    {
+        try
+        {
+            Client client(options.path, options.binary);
+            std::mt19937_64 random(options.seed + static_cast<uint64_t>(index));
+            std::uniform_int_distribution<int> cell(0, options.size - 1);
+            std::uniform_int_distribution<int> percent(0, 99);
+            uint32_t tag = 0;
+            std::vector<uint64_t> sessions;
+            std::vector<int> moves; // Moves per session, undo is only sent if there is a move to undo.
+
+            GameServer::Request request;
+            request.command = GameServer::Command::New;
+            request.size = options.size;
+            request.difficulty = options.size;
+            request.seeded = true;
+            for (int i = 0; i < options.sessions; ++i)
+            {
+                request.tag = ++tag;
+                request.seed = random();
+                GameServer::Response response = client.call(request);
+                if (!response.ok)
+                    throw std::runtime_error("Cannot create a session: " + response.error);
+                sessions.push_back(response.session);
+                moves.push_back(0);
+            }
+
+            std::uniform_int_distribution<std::size_t> pick(0, sessions.size() - 1);
+            request.seeded = false;
+            for (long long i = 0; i < ops; ++i)
+            {
+                std::size_t session = pick(random);
+                int roll = percent(random);
+                request.tag = ++tag;
+                request.session = sessions[session];
+                if (roll < 10 && moves[session] > 0)
+                    request.command = GameServer::Command::Undo;
+                else if (roll >= 90 && roll < 95)
+                    request.command = GameServer::Command::State;
+                else if (roll >= 95)
+                    request.command = GameServer::Command::Hint;
+                else
+                {
+                    request.command = GameServer::Command::Move;
+                    request.row = cell(random);
+                    request.col = cell(random);
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                GameServer::Response response = client.call(request);
+                auto end = std::chrono::steady_clock::now();
+                results.latencies[static_cast<int>(request.command)].push_back(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+                if (response.ok)
+                    moves[session] = response.moves;
+                else
+                    ++results.errors; // E.g. a hint on a won board.
+            }
+
+            request.command = GameServer::Command::Close;
+            for (uint64_t id : sessions)
+            {
+                request.tag = ++tag;
+                request.session = id;
+                client.call(request);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            results.failure = e.what();
+        }
+    }
+#endif
+
+    double percentile(std::vector<long long> &values, double fraction)
+    {
+        std::size_t at = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(at), values.end());
+        return static_cast<double>(values[at]) / 1000.0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string name = argv[i];
+        if (name == "--help" || name == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        if (name == "--binary")
+        {
+            options.binary = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (name == "--socket")
+            options.path = value;
+        else if (name == "--connections")
+            options.connections = std::atoi(value.c_str());
+        else if (name == "--sessions")
+            options.sessions = std::atoi(value.c_str());
+        else if (name == "--ops")
+            options.ops = std::atoll(value.c_str());
+        else if (name == "--size")
+            options.size = std::atoi(value.c_str());
+        else if (name == "--seed")
+            options.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    if (options.path.empty() || options.connections < 1 || options.sessions < 1 || options.ops < 0 || options.size < 1)
+    {
+        printUsage();
+        return 1;
+    }
+
+#ifdef _WIN32
+    std::cerr << "target9-load needs a POSIX system" << std::endl;
+    return 1;
+#else
+    std::vector<Results> results(static_cast<std::size_t>(options.connections));
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.connections; ++i)
+    {
+        // The requests are spread evenly, the first connections take the remainder.
+        long long ops = options.ops / options.connections + (i < options.ops % options.connections ? 1 : 0);
+        threads.emplace_back(runConnection, std::cref(options), i, ops, std::ref(results[static_cast<std::size_t>(i)]));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool failed = false;
+    long long errors = 0;
+    std::vector<long long> all;
+    std::vector<long long> perCommand[COMMAND_COUNT];
+    for (Results &result : results)
+    {
+        if (!result.failure.empty())
+        {
+            std::cerr << "Connection failed: " << result.failure << std::endl;
+            failed = true;
+        }
+        errors += result.errors;
+        for (int command = 0; command < COMMAND_COUNT; ++command)
+        {
+            perCommand[command].insert(perCommand[command].end(), result.latencies[command].begin(), result.latencies[command].end());
+            all.insert(all.end(), result.latencies[command].begin(), result.latencies[command].end());
+        }
+    }
+
+    std::printf("%-8s %10s %12s %12s\n", "command", "requests", "p50 (us)", "p99 (us)");
+    for (int command = 0; command < COMMAND_COUNT; ++command)
+    {
+        std::vector<long long> &values = perCommand[command];
+        if (!values.empty())
+        {
+            std::printf("%-8s %10zu %12.1f %12.1f\n", ServerProtocol::commandName(static_cast<GameServer::Command>(command)),
+                        values.size(), percentile(values, 0.5), percentile(values, 0.99));
+        }
+    }
+    if (!all.empty())
+    {
+        std::printf("%-8s %10zu %12.1f %12.1f\n", "all", all.size(), percentile(all, 0.5), percentile(all, 0.99));
+    }
+    std::printf("%.0f requests/s over %d connections in %.2f s, %lld failed requests\n",
+                static_cast<double>(all.size()) / seconds, options.connections, seconds, errors);
+    return failed ? 1 : 0;
+#endif
+}
@@ -0,0 +1,394 @@
+/**
+ * @file target9_server.cpp
+ * @brief Headless game server for bots, load tests and web bridges.
+ *
+ * Usage: target9-server [--workers N] [--socket PATH] [--binary] [--hint-cache MB]
+ *        [--max-sessions N] [--max-cells N] [--max-size N] [--max-history N] [--max-queue N] [--max-clients N]
+ *
+ * Without --socket the server reads requests from stdin and writes responses to stdout until stdin is
+ * closed. With --socket it listens on a Unix domain socket and serves any number of clients at once;
+ * sessions belong to the server, so a client may reconnect and continue them. Requests are JSON lines
+ * by default or binary records with --binary, see serverprotocol.hpp. Responses of different sessions
+ * may arrive in any order, clients match them by their tag. Hints of all sessions share a cache of
+ * --hint-cache megabytes, 64 by default, 0 disables it.
+ *
+ * Clients are not trusted. New requests fail once the server holds --max-sessions sessions (65536 by
+ * default) or --max-cells cells (16M), or ask for a board larger than --max-size (256). Moves fail in a
+ * session with --max-history moves (1M) in its history. A client is not read from while --max-queue
+ * requests (4096) wait on the worker of its request. 0 removes a limit.
+ * Over --max-clients connected clients (1024), new clients are refused. Workers never write to a client,
+ * they queue responses in its outbox, and a client that lets 16 MB of responses pile up or sends a line
+ * longer than 64 KB is disconnected.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 17.10.2026
+ */
+#include "gameserver.hpp"
+#include "serverprotocol.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    void printUsage()
+    {
+        std::cerr << "Usage: target9-server [--workers N] [--socket PATH] [--binary] [--hint-cache MB]"
+                     " [--max-sessions N] [--max-cells N] [--max-size N] [--max-history N] [--max-queue N] [--max-clients N]"
+                  << std::endl;
+    }
+
+#ifndef _WIN32
+    const char *socketPath = nullptr; // Removed on exit.
+
+    void stop(int)
+    {
+        if (socketPath)
+        {
+            unlink(socketPath);
+        }
+        _exit(0);
+    }
+
+    constexpr std::size_t MAX_OUTBOX_BYTES = 1 << 24; // Responses a client may leave unread.
+    constexpr std::size_t MAX_LINE_BYTES = 1 << 16;   // JSON requests are far shorter.
+
+    // Stream of a client, shared by its reader and the workers answering its requests. Workers only queue
+    // responses, the writer thread of the connection writes them, so a slow client never holds up a worker.
+    struct Connection
+    {
+        int input;
+        int output;
+        std::mutex lock;
+        std::condition_variable changed; // Outbox filled, request answered, connection closing or broken.
+        std::string outbox;              // Responses not written yet.
+        std::size_t waiting = 0;         // Requests submitted and not answered yet.
+        bool closing = false;            // No more requests, the writer stops once the outbox is empty.
+        bool broken = false;             // Set when the client is gone or dropped, later responses are dropped.
+        std::thread writer;
+
+        Connection(int input, int output) : input(input), output(output), writer([this]
+                                                                                  { drain(); }) {}
+
+        ~Connection()
+        {
+            if (input > STDERR_FILENO)
+            {
+                close(input); // Sockets use one descriptor for both directions.
+            }
+        }
+
+        // Queue a response, never blocks on the client.
+        void send(const std::string &bytes, bool answer = false)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (answer)
+                --waiting;
+            if (!broken && outbox.size() + bytes.size() > MAX_OUTBOX_BYTES)
+                drop(); // The client does not read its responses.
+            if (!broken)
+                outbox += bytes;
+            changed.notify_all();
+        }
+
+        // Count a request whose response will come from a worker.
+        void submitted()
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            ++waiting;
+        }
+
+        // Called by the reader after the last request: waits for the responses and writes them, then stops the writer.
+        void finish()
+        {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                changed.wait(guard, [this]
+                             { return waiting == 0; });
+                closing = true;
+            }
+            changed.notify_all();
+            writer.join();
+        }
+
+        // Disconnect the client, called with the lock held. A blocked read() or write() returns.
+        void drop()
+        {
+            broken = true;
+            outbox.clear();
+            if (input > STDERR_FILENO)
+                shutdown(input, SHUT_RDWR);
+        }
+
+        void drain()
+        {
+            std::string bytes;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    changed.wait(guard, [this]
+                                 { return broken || closing || !outbox.empty(); });
+                    if (broken || outbox.empty())
+                        return;
+                    bytes.swap(outbox);
+                }
+                std::size_t sent = 0;
+                while (sent < bytes.size())
+                {
+                    ssize_t written = write(output, bytes.data() + sent, bytes.size() - sent);
+                    if (written < 0 && errno == EINTR)
+                        continue;
+                    if (written <= 0)
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        drop();
+                        return;
+                    }
+                    sent += static_cast<std::size_t>(written);
+                }
+                bytes.clear();
+            }
+        }
+    };
+
+    // Encode a failure that belongs to no request.
+    std::string errorBytes(const std::string &error, bool binary)
+    {
+        if (!binary)
+            return ServerProtocol::formatError(0, error);
+        GameServer::Response response;
+        response.ok = false;
+        response.error = error;
+        std::string bytes;
+        ServerProtocol::encodeResponse(response, bytes);
+        return bytes;
+    }
+
+    // Read requests of a client until it disconnects and submit them to the server. submit() waits while the
+    // worker queue is full, so a client sending faster than it is served is not read from until there is room.
+    void readRequests(GameServer &server, const std::shared_ptr<Connection> &connection, bool binary)
+    {
+        std::string pending;
+        std::string error;
+        char chunk[1 << 16];
+        while (true)
+        {
+            ssize_t received = read(connection->input, chunk, sizeof(chunk));
+            if (received < 0 && errno == EINTR)
+                continue;
+            if (received <= 0)
+                return;
+            pending.append(chunk, static_cast<std::size_t>(received));
+
+            std::size_t used = 0;
+            while (true)
+            {
+                GameServer::Request request;
+                bool valid;
+                if (binary)
+                {
+                    if (pending.size() - used < ServerProtocol::REQUEST_BYTES)
+                        break;
+                    valid = ServerProtocol::decodeRequest(reinterpret_cast<const unsigned char *>(pending.data() + used), request, error);
+                    used += ServerProtocol::REQUEST_BYTES;
+                }
+                else
+                {
+                    std::size_t end = pending.find('\n', used);
+                    if (end == std::string::npos)
+                    {
+                        if (pending.size() - used > MAX_LINE_BYTES)
+                        {
+                            connection->send(errorBytes("Request line is too long", false));
+                            return; // Not a client of this protocol.
+                        }
+                        break;
+                    }
+                    std::string line = pending.substr(used, end - used);
+                    used = end + 1;
+                    if (!line.empty() && line.back() == '\r')
+                        line.pop_back();
+                    if (line.empty())
+                        continue;
+                    valid = ServerProtocol::parseRequest(line, request, error);
+                }
+
+                if (!valid)
+                {
+                    GameServer::Response response;
+                    response.command = request.command;
+                    response.tag = request.tag;
+                    response.ok = false;
+                    response.error = error;
+                    std::string bytes;
+                    if (binary)
+                        ServerProtocol::encodeResponse(response, bytes);
+                    else
+                        bytes = ServerProtocol::formatError(request.tag, error);
+                    connection->send(bytes);
+                    continue;
+                }
+                connection->submitted();
+                server.submit(request, [connection, binary](const GameServer::Response &response)
+                              {
+                                  std::string bytes;
+                                  if (binary)
+                                      ServerProtocol::encodeResponse(response, bytes);
+                                  else
+                                      bytes = ServerProtocol::formatResponse(response);
+                                  connection->send(bytes, true); });
+            }
+            pending.erase(0, used);
+        }
+    }
+
+    // Serve a client until it disconnects and all its requests are answered.
+    void serve(GameServer &server, const std::shared_ptr<Connection> &connection, bool binary)
+    {
+        readRequests(server, connection, binary);
+        connection->finish();
+    }
+
+    int listenOn(const std::string &path)
+    {
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path))
+        {
+            std::cerr << "Socket path is too long: " << path << std::endl;
+            return -1;
+        }
+        address.sun_family = AF_UNIX;
+        std::strcpy(address.sun_path, path.c_str());
+        int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        unlink(path.c_str()); // Left over by a server that was killed.
+        if (listener < 0 || bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(listener, 128) != 0)
+        {
+            std::cerr << "Cannot listen on " << path << ": " << std::strerror(errno) << std::endl;
+            return -1;
+        }
+        return listener;
+    }
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    std::string path;
+    bool binary = false;
+    std::size_t hintCacheBytes = HintCache::DEFAULT_BUDGET;
+    GameServer::Limits limits;
+    std::size_t maxClients = 1024;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string name = argv[i];
+        if (name == "--help" || name == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        if (name == "--binary")
+        {
+            binary = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (name == "--workers")
+            workers = std::atoi(value.c_str());
+        else if (name == "--socket")
+            path = value;
+        else if (name == "--hint-cache")
+            hintCacheBytes = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10)) << 20;
+        else if (name == "--max-sessions")
+            limits.maxSessions = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else if (name == "--max-cells")
+            limits.maxCells = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else if (name == "--max-size")
+            limits.maxSize = std::atoi(value.c_str());
+        else if (name == "--max-history")
+            limits.maxHistory = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else if (name == "--max-queue")
+            limits.maxQueue = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else if (name == "--max-clients")
+            maxClients = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+#ifdef _WIN32
+    std::cerr << "target9-server needs a POSIX system" << std::endl;
+    return 1;
+#else
+    std::signal(SIGPIPE, SIG_IGN); // A client that went away is noticed by write().
+    GameServer server(workers, hintCacheBytes, limits);
+
+    if (path.empty())
+    {
+        serve(server, std::make_shared<Connection>(STDIN_FILENO, STDOUT_FILENO), binary);
+        return 0; // The server answers all requests before it is destroyed.
+    }
+
+    int listener = listenOn(path);
+    if (listener < 0)
+    {
+        return 1;
+    }
+    socketPath = path.c_str();
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+    std::cerr << "Listening on " << path << " with " << server.getWorkerCount() << " workers" << std::endl;
+    std::atomic<std::size_t> clients(0); // Client threads are detached, this counts the running ones.
+    while (true)
+    {
+        int client = accept(listener, nullptr, nullptr);
+        if (client < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            std::cerr << "Cannot accept a client: " << std::strerror(errno) << std::endl;
+            unlink(socketPath);
+            return 1;
+        }
+        if (maxClients != 0 && clients >= maxClients)
+        {
+            std::string bytes = errorBytes("Too many clients", binary);
+            ssize_t written = write(client, bytes.data(), bytes.size()); // Fits in the empty socket buffer.
+            (void)written;
+            close(client);
+            continue;
+        }
+        ++clients;
+        std::thread([&server, &clients, client, binary]
+                    {
+                        serve(server, std::make_shared<Connection>(client, client), binary);
+                        --clients; })
+            .detach();
+    }
+#endif
+}
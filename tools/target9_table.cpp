@@ -0,0 +1,38 @@
+/**
+ * @file target9_table.cpp
+ * @brief Command line tool that writes the 3x3 distance table used by DistanceTable.
+ *
+ * Usage: target9-table [output path] [threads]
+ * By default the table is written to target9_3x3.tbl using all hardware threads.
+ *
+ * @author Ignat Romanov
+ * @version 1.0
+ * @date 16.10.2026
+ */
+#include "distancetable.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char *argv[])
+{
+    std::string path = argc > 1 ? argv[1] : "target9_3x3.tbl";
+    int threads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!DistanceTable::generate(path, threads))
+    {
+        std::cerr << "Cannot write " << path << std::endl;
+        return 1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Wrote " << DistanceTable::STATES << " states to " << path << " in " << elapsed.count() << " s using " << threads << " threads" << std::endl;
+    return 0;
+}